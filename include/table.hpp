@@ -1,26 +1,430 @@
 #ifndef TABLE_HPP
 #define TABLE_HPP
 
+#include <tuple>
 #include <vector>
+#include <cstdint>
 #include <cstddef>
+#include <cstdlib>
 #include <climits>
 #include <utility>
+#include <optional>
+#include <iterator>
 #include <algorithm>
+#include <type_traits>
+#include <unordered_map>
+
+#if __cplusplus >= 202002L && __has_include(<ranges>)
+#include <ranges>
+#endif
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#include <xmmintrin.h>
+#endif
 
 namespace ds {
 
+/// @brief A rectangular region of a table, given by the position of its top-left cell and its dimensions.
+
+struct rect {
+    int row;
+    int column;
+    int rows;
+    int cols;
+};
+
+/// @brief The position and contents of an occupied table cell.
+
+template<typename value_type>
+struct cell {
+    int row;
+    int column;
+    value_type const& value;
+};
+
+/// @class Indexed view
+/// @brief A sized, random-access range whose elements are computed from their index by an accessor.
+/// @note The range and its iterators refer to the table that created them and are invalidated by any modification of that table.
+
+template<typename accessor>
+class indexed_view {
+public:
+    using result_type = decltype(std::declval<accessor const&>()(std::size_t {0}));
+
+    class iterator {
+    public:
+        using iterator_concept = std::random_access_iterator_tag;
+        using iterator_category = std::input_iterator_tag;
+        using value_type = std::remove_cv_t<std::remove_reference_t<result_type>>;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = result_type;
+
+        iterator() = default;
+
+        iterator(accessor function, std::size_t index): function(function), index(index) {
+        }
+
+        inline reference operator*() const { return function(index); }
+        inline reference operator[](difference_type n) const { return function(index + n); }
+
+        inline iterator& operator++() { ++index; return *this; }
+        inline iterator& operator--() { --index; return *this; }
+        inline iterator operator++(int) { auto copy = *this; ++index; return copy; }
+        inline iterator operator--(int) { auto copy = *this; --index; return copy; }
+        inline iterator& operator+=(difference_type n) { index += n; return *this; }
+        inline iterator& operator-=(difference_type n) { index -= n; return *this; }
+
+        inline friend iterator operator+(iterator it, difference_type n) { return it += n; }
+        inline friend iterator operator+(difference_type n, iterator it) { return it += n; }
+        inline friend iterator operator-(iterator it, difference_type n) { return it -= n; }
+        inline friend difference_type operator-(iterator const& a, iterator const& b) {
+            return static_cast<difference_type>(a.index) - static_cast<difference_type>(b.index);
+        }
+
+        inline friend bool operator==(iterator const& a, iterator const& b) { return a.index == b.index; }
+        inline friend bool operator!=(iterator const& a, iterator const& b) { return a.index != b.index; }
+        inline friend bool operator<(iterator const& a, iterator const& b) { return a.index < b.index; }
+        inline friend bool operator>(iterator const& a, iterator const& b) { return a.index > b.index; }
+        inline friend bool operator<=(iterator const& a, iterator const& b) { return a.index <= b.index; }
+        inline friend bool operator>=(iterator const& a, iterator const& b) { return a.index >= b.index; }
+
+    private:
+        accessor function {};
+        std::size_t index {0};
+    };
+
+public:
+    indexed_view() = default;
+
+    indexed_view(accessor function, std::size_t length): function(function), length(length) {
+    }
+
+    inline iterator begin() const { return {function, 0}; }
+    inline iterator end() const { return {function, length}; }
+    inline std::size_t size() const noexcept { return length; }
+    inline bool empty() const noexcept { return length == 0; }
+    inline result_type operator[](std::size_t index) const { return function(index); }
+
+private:
+    accessor function {};
+    std::size_t length {0};
+};
+
+/// @brief The outcome of a table operation that reports failure by value rather than by exception.
+
+enum class status {
+    ok,
+    full,
+    empty,
+    out_of_range
+};
+
+/// @brief Get the index of the least significant set bit of the given non-zero word.
+
+[[nodiscard]]
+inline int count_trailing_zeros(std::uint64_t const word) noexcept {
+#if defined(_MSC_VER) && !defined(__clang__)
+    unsigned long index;
+    _BitScanForward64(&index, word);
+    return static_cast<int>(index);
+#else
+    return __builtin_ctzll(word);
+#endif
+}
+
+/// @brief Get the number of set bits of the given word.
+
+[[nodiscard]]
+inline int popcount(std::uint64_t const word) noexcept {
+#if defined(_MSC_VER) && !defined(__clang__)
+    return static_cast<int>(__popcnt64(word));
+#else
+    return __builtin_popcountll(word);
+#endif
+}
+
+/// @brief Hint to the processor that the given address will soon be read, so that it can be fetched into the cache.
+
+inline void prefetch(void const* address) noexcept {
+#if defined(_MSC_VER) && !defined(__clang__)
+    _mm_prefetch(static_cast<char const*>(address), _MM_HINT_T0);
+#else
+    __builtin_prefetch(address);
+#endif
+}
+
+/// @brief Invoke the given task with the index of each set bit of the given words, in ascending order.
+/// @param words A pointer to the first word of the bitmap.
+/// @param number_of_words The number of words in the bitmap.
+
+template<typename task_function>
+inline void for_each_set_bit(std::uint64_t const* words, std::size_t const number_of_words, task_function&& task) {
+    for (auto w = std::size_t {0}; w < number_of_words; ++w) {
+        for (auto word = words[w]; word != 0; word &= word - 1) {
+            task(static_cast<int>(w * 64) + count_trailing_zeros(word));
+        }
+    }
+}
+
+/// @brief Invoke the given task with the index of each set bit in the range [first, last) of the given bitmap, in ascending order.
+
+template<typename task_function>
+inline void for_each_set_bit(std::uint64_t const* words, std::size_t const first, std::size_t const last, task_function&& task) {
+    if (first >= last)
+        return;
+
+    auto const head = first >> 6;
+    auto const tail = (last - 1) >> 6;
+
+    for (auto w = head; w <= tail; ++w) {
+        auto word = words[w];
+        if (w == head)
+            word &= ~std::uint64_t {0} << (first & 63);
+        if (w == tail && (last & 63) != 0)
+            word &= ~(~std::uint64_t {0} << (last & 63));
+
+        for (; word != 0; word &= word - 1) {
+            task(static_cast<int>(w * 64) + count_trailing_zeros(word));
+        }
+    }
+}
+
+/// @class Row index
+/// @brief A table policy that maintains an occupancy bitmap for each row, so that the occupied cells
+/// of a row can be visited in column order in time proportional to cols / 64 plus the number of items in the row.
+/// @note Maintenance costs a single bit operation on `set`, `emplace` and `erase`.
+/// @example `ds::table<int, ds::row_index>`
+
+class row_index {
+public:
+    row_index(std::size_t const number_of_rows, std::size_t const number_of_cols):
+            cols(number_of_cols),
+            words_per_row((number_of_cols + 63) / 64),
+            bits(number_of_rows * words_per_row, 0) {
+    }
+
+    template<typename value_type>
+    inline void insert(int const row, int const column, value_type const&) noexcept {
+        bits[row * words_per_row + (column >> 6)] |= std::uint64_t {1} << (column & 63);
+    }
+
+    template<typename value_type>
+    inline void erase(int const row, int const column, value_type const&) noexcept {
+        bits[row * words_per_row + (column >> 6)] &= ~(std::uint64_t {1} << (column & 63));
+    }
+
+    /// @brief Invoke the given task with the column index of each occupied cell of the given row, in ascending order.
+    /// @param first The column at which to start, after which the visit wraps around to the columns before it.
+
+    template<typename task_function>
+    inline void for_each_in_row(int const row, task_function&& task, std::size_t const first = 0) const {
+        auto const words = bits.data() + row * words_per_row;
+        for_each_set_bit(words, first, cols, task);
+        for_each_set_bit(words, 0, first, task);
+    }
+
+private:
+    std::size_t cols;
+    std::size_t words_per_row;
+    std::vector<std::uint64_t> bits;
+};
+
+/// @class Column index
+/// @brief A table policy that maintains an occupancy bitmap for each column, stored contiguously, so that the
+/// occupied cells of a column can be visited in row order in time proportional to rows / 64 plus the number of items in the column.
+/// @note Maintenance costs a single bit operation on `set`, `emplace` and `erase`.
+/// @example `ds::table<int, ds::column_index>`
+
+class column_index {
+public:
+    column_index(std::size_t const number_of_rows, std::size_t const number_of_cols):
+            rows(number_of_rows),
+            words_per_col((number_of_rows + 63) / 64),
+            bits(number_of_cols * words_per_col, 0) {
+    }
+
+    template<typename value_type>
+    inline void insert(int const row, int const column, value_type const&) noexcept {
+        bits[column * words_per_col + (row >> 6)] |= std::uint64_t {1} << (row & 63);
+    }
+
+    template<typename value_type>
+    inline void erase(int const row, int const column, value_type const&) noexcept {
+        bits[column * words_per_col + (row >> 6)] &= ~(std::uint64_t {1} << (row & 63));
+    }
+
+    /// @brief Invoke the given task with the row index of each occupied cell of the given column, in ascending order.
+    /// @param first The row at which to start, after which the visit wraps around to the rows before it.
+
+    template<typename task_function>
+    inline void for_each_in_column(int const column, task_function&& task, std::size_t const first = 0) const {
+        auto const words = bits.data() + column * words_per_col;
+        for_each_set_bit(words, first, rows, task);
+        for_each_set_bit(words, 0, first, task);
+    }
+
+private:
+    std::size_t rows;
+    std::size_t words_per_col;
+    std::vector<std::uint64_t> bits;
+};
+
+/// @class Occupancy counts
+/// @brief A table policy that maintains the number of occupied cells in each row and each column,
+/// as well as the number of rows and columns that are full, so that these can be queried in constant time.
+/// @note Maintenance costs a constant number of increments on `set`, `emplace` and `erase`.
+/// @example `ds::table<int, ds::occupancy_counts>`
+
+class occupancy_counts {
+public:
+    occupancy_counts(std::size_t const number_of_rows, std::size_t const number_of_cols):
+            row_counts(number_of_rows, 0),
+            col_counts(number_of_cols, 0) {
+    }
+
+    template<typename value_type>
+    inline void insert(int const row, int const column, value_type const&) noexcept {
+        full_rows += ++row_counts[row] == static_cast<int>(col_counts.size());
+        full_cols += ++col_counts[column] == static_cast<int>(row_counts.size());
+    }
+
+    template<typename value_type>
+    inline void erase(int const row, int const column, value_type const&) noexcept {
+        full_rows -= row_counts[row]-- == static_cast<int>(col_counts.size());
+        full_cols -= col_counts[column]-- == static_cast<int>(row_counts.size());
+    }
+
+    /// @brief Get the number of occupied cells in the given row.
+
+    [[nodiscard]]
+    inline int count_in_row(int const row) const noexcept {
+        return row_counts[row];
+    }
+
+    /// @brief Get the number of occupied cells in the given column.
+
+    [[nodiscard]]
+    inline int count_in_column(int const column) const noexcept {
+        return col_counts[column];
+    }
+
+    /// @brief Indicate whether every cell of the given row is occupied or not.
+
+    [[nodiscard]]
+    inline bool is_row_full(int const row) const noexcept {
+        return row_counts[row] == static_cast<int>(col_counts.size());
+    }
+
+    /// @brief Indicate whether every cell of the given column is occupied or not.
+
+    [[nodiscard]]
+    inline bool is_column_full(int const column) const noexcept {
+        return col_counts[column] == static_cast<int>(row_counts.size());
+    }
+
+    /// @brief Get the number of rows whose cells are all occupied.
+
+    [[nodiscard]]
+    inline int number_of_full_rows() const noexcept {
+        return full_rows;
+    }
+
+    /// @brief Get the number of columns whose cells are all occupied.
+
+    [[nodiscard]]
+    inline int number_of_full_columns() const noexcept {
+        return full_cols;
+    }
+
+private:
+    std::vector<int> row_counts;
+    std::vector<int> col_counts;
+    int full_rows {0};
+    int full_cols {0};
+};
+
+/// @brief A key extractor that uses each data item as its own key.
+
+struct identity_key {
+    template<typename value_type>
+    inline value_type const& operator()(value_type const& value) const noexcept {
+        return value;
+    }
+};
+
+/// @class Reverse index
+/// @brief A table policy that maintains a hash index from a key of each data item to the position of its cell,
+/// so that the cell holding a given key can be found in constant time.
+/// @tparam key_type The type of the keys, which must be hashable.
+/// @tparam key_extractor A default-constructible function that maps a data item to its key.
+/// @note Keys should be unique. If several cells hold the same key, the index holds the most recent of them.
+/// Maintenance costs a hash map insertion on `set`, `emplace` and `modify`, and a removal on `erase`, which
+/// may allocate memory. Swap-and-erase moves of the data items don't change their positions, so they're free.
+/// @example `ds::table<entity, ds::reverse_index<int, entity_id>>`
+
+template<typename key_type, typename key_extractor = identity_key>
+class reverse_index {
+public:
+    reverse_index(std::size_t, std::size_t const number_of_cols):
+            cols(static_cast<int>(number_of_cols)) {
+    }
+
+    template<typename value_type>
+    inline void insert(int const row, int const column, value_type const& value) {
+        positions[key(value)] = row * cols + column;
+    }
+
+    template<typename value_type>
+    inline void erase(int const row, int const column, value_type const& value) {
+        auto const entry = positions.find(key(value));
+        if (entry != positions.end() && entry->second == row * cols + column)
+            positions.erase(entry);
+    }
+
+    /// @brief Get the position of the cell that holds the given key, if any.
+    /// @return The (row, column) position of the cell, which is physical if the table has been scrolled.
+
+    [[nodiscard]]
+    inline std::optional<std::pair<int, int>> find(key_type const& k) const {
+        auto const entry = positions.find(k);
+        if (entry == positions.end())
+            return std::nullopt;
+
+        return std::make_pair(entry->second / cols, entry->second % cols);
+    }
+
+    /// @brief Get the number of keys in the index.
+
+    [[nodiscard]]
+    inline std::size_t size() const noexcept {
+        return positions.size();
+    }
+
+private:
+    int cols;
+    key_extractor key;
+    std::unordered_map<key_type, int> positions;
+};
+
 /// @class Table
 /// @brief An array type that provides a virtual grid topology.
+/// @tparam policies Optional policies that maintain auxiliary indices over the table's cells.
+/// Each policy is constructed with the table's dimensions and is notified after an item is inserted
+/// and before an item is erased, via `insert(row, column, value)` and `erase(row, column, value)`.
+/// Policies are notified with physical positions, which differ from the table's positions after `scroll`.
 
-template<typename value_type>
+template<typename value_type, typename... policies>
 class table {
 public:
     /// @brief Construct an empty table.
 
     table():
-            rows(default_size),
-            cols(default_size) {
-        table_indices.assign(rows * cols, none);
+            height(default_size),
+            width(default_size),
+            extensions(policies(default_size, default_size)...) {
+        table_indices.assign(height * width, none);
     }
 
     /// @brief Construct an empty table with the given dimensions.
@@ -28,9 +432,10 @@ public:
     /// @param number_of_cols The desired number of columns.
 
     table(std::size_t number_of_rows, std::size_t number_of_cols):
-            rows(number_of_rows),
-            cols(number_of_cols) {
-        table_indices.assign(rows * cols, none);
+            height(number_of_rows),
+            width(number_of_cols),
+            extensions(policies(number_of_rows, number_of_cols)...) {
+        table_indices.assign(height * width, none);
     }
 
 public:
@@ -39,7 +444,7 @@ public:
 
     [[nodiscard]]
     inline int size() const noexcept {
-        return rows * cols;
+        return height * width;
     }
 
     /// @brief Get the dimensions of the table.
@@ -47,7 +452,7 @@ public:
 
     [[nodiscard]]
     inline std::pair<std::size_t, std::size_t> dimensions() const noexcept {
-        return {rows, cols};
+        return {height, width};
     }
 
     /// @brief Get the number of data items stored in the table.
@@ -151,12 +556,13 @@ public:
         auto const n = static_cast<int>(cells.size());
 
         if (contains(t)) {
-            return modify(table_indices.at(t), element);
+            return modify(t, table_indices.at(t), element);
         }
 
         cells.push_back(element);
         cells_indices.push_back(t);
         table_indices.at(t) = n;
+        notify_insert(t, cells.back());
 
         return cells.back();
     }
@@ -172,12 +578,13 @@ public:
         auto const n = static_cast<int>(cells.size());
 
         if (contains(t)) {
-            return modify(table_indices.at(t), value_type(std::forward<Arguments>(arguments)...));
+            return modify(t, table_indices.at(t), value_type(std::forward<Arguments>(arguments)...));
         }
 
         cells.emplace_back(arguments...);
         cells_indices.push_back(t);
         table_indices.at(t) = n;
+        notify_insert(t, cells.back());
 
         return cells.back();
     }
@@ -189,6 +596,8 @@ public:
     inline void erase(int const row, int const column) noexcept(false) {
         auto const table_int = get_table_index(row, column);
         auto const cells_int = table_indices.at(table_int);
+        notify_erase(table_int, cells.at(cells_int));
+
         auto const updatable = swap_and_erase(cells_int);
         table_indices.at(table_int) = none;
 
@@ -197,10 +606,227 @@ public:
         }
     }
 
+    /// @brief Reserve capacity for the given number of data items.
+    /// @param capacity The number of data items that the table should be able to hold without reallocating.
+
+    inline void reserve(std::size_t const capacity) {
+        cells.reserve(capacity);
+        cells_indices.reserve(capacity);
+    }
+
     /// @brief Reset the state of the table at the current size.
+    /// @note The amount of time required is linear in the number of data items, and no memory is allocated.
+    /// The origin is also reset, so that the physical layout matches the table's positions.
 
     inline void reset() {
-        *this = table<value_type>(rows, cols);
+        for (auto i = std::size_t {0}; i < cells.size(); ++i) {
+            auto const t = cells_indices[i];
+            notify_erase(t, cells[i]);
+            table_indices[t] = none;
+        }
+
+        cells.clear();
+        cells_indices.clear();
+        origin_row = 0;
+        origin_column = 0;
+    }
+
+    /// @brief Scroll the table by the given number of rows and columns, so that the contents of the cell
+    /// at (row, column) move to (row - rows, column - columns).
+    /// @param rows The number of rows to scroll by, which is positive to scroll towards the last row.
+    /// @param columns The number of columns to scroll by, which is positive to scroll towards the last column.
+    /// @note The cells that are scrolled past the edge of the table are erased, and the cells that are
+    /// exposed on the opposite edge are empty. No data item is moved: only the origin of the ring-buffered
+    /// lookup table changes, so the amount of time required is linear in the number of exposed cells.
+
+    void scroll(int const rows, int const columns) {
+        auto const h = static_cast<int>(height);
+        auto const w = static_cast<int>(width);
+
+        if (rows <= -h || rows >= h || columns <= -w || columns >= w) {
+            reset();
+            return;
+        }
+
+        origin_row = (origin_row + rows + h) % h;
+        origin_column = (origin_column + columns + w) % w;
+
+        auto const first_row = rows > 0 ? h - rows : 0;
+        for (auto row = first_row; row < first_row + std::abs(rows); ++row) {
+            for (auto column = 0; column < w; ++column) {
+                clear(get_table_index(row, column));
+            }
+        }
+
+        auto const first_column = columns > 0 ? w - columns : 0;
+        for (auto row = 0; row < h; ++row) {
+            for (auto column = first_column; column < first_column + std::abs(columns); ++column) {
+                clear(get_table_index(row, column));
+            }
+        }
+    }
+
+    /// @brief Get the origin of the ring-buffered lookup table, which is the physical position of the cell at (0, 0).
+    /// @return The physical position of the cell at (0, 0), (row, column), which is (0, 0) unless the table has been scrolled.
+
+    [[nodiscard]]
+    inline std::pair<int, int> origin() const noexcept {
+        return {origin_row, origin_column};
+    }
+
+    /// @brief Move the origin of the ring-buffered lookup table back to (0, 0) without changing the table's contents.
+    /// @note The amount of time required is linear in the size of the table. This restores the physical layout
+    /// of `lookup()` and `indices()` to the table's positions, so that they can be read without `ds::ring_layout`.
+
+    void normalise() {
+        if (origin_row == 0 && origin_column == 0)
+            return;
+
+        for (auto i = std::size_t {0}; i < cells.size(); ++i) {
+            notify_erase(cells_indices[i], cells[i]);
+        }
+
+        auto const w = static_cast<std::ptrdiff_t>(width);
+        for (auto row = table_indices.begin(); row != table_indices.end(); row += w) {
+            std::rotate(row, row + origin_column, row + w);
+        }
+
+        std::rotate(table_indices.begin(), table_indices.begin() + origin_row * w, table_indices.end());
+
+        for (auto i = std::size_t {0}; i < cells.size(); ++i) {
+            auto const t = cells_indices[i];
+            cells_indices[i] = logical_row(t / width) * static_cast<int>(width) + logical_column(t % width);
+        }
+
+        origin_row = 0;
+        origin_column = 0;
+
+        for (auto i = std::size_t {0}; i < cells.size(); ++i) {
+            notify_insert(cells_indices[i], cells[i]);
+        }
+    }
+
+public:
+    /// @brief Try to set the value of the table cell at the given position without allocating memory.
+    /// @param row The row index of the desired table cell.
+    /// @param column The column index of the desired table cell.
+    /// @param element The element that should be moved into the table cell.
+    /// @return `status::ok` if the cell was set, `status::out_of_range` if the position is invalid, or
+    /// `status::full` if the cell is empty and the table has no spare capacity.
+    /// @note This is safe to call from a real-time thread once capacity has been reserved, provided that no policy allocates.
+    /// It is `noexcept` only if moving a data item and notifying each policy are. The amount of time required is constant,
+    /// plus the time required by each policy.
+
+    inline status try_set(int const row, int const column, value_type element) noexcept(nothrow_movable && nothrow_policies) {
+        return try_emplace(row, column, std::move(element));
+    }
+
+    /// @brief Try to construct the value of the table cell at the given position without allocating memory.
+    /// @param row The row index of the desired table cell.
+    /// @param column The column index of the desired table cell.
+    /// @param arguments The parameters that should be used to construct the new data item.
+    /// @see `ds::table::try_set`
+
+    template<typename ...Arguments>
+    inline status try_emplace(int const row, int const column, Arguments&& ... arguments)
+            noexcept(nothrow_movable && nothrow_policies && std::is_nothrow_constructible_v<value_type, Arguments&&...>) {
+        if (!inside(row, column))
+            return status::out_of_range;
+
+        auto const t = get_table_index(row, column);
+        auto const i = table_indices[t];
+
+        if (i != none) {
+            notify_erase(t, cells[i]);
+            cells[i] = value_type(std::forward<Arguments>(arguments)...);
+            notify_insert(t, cells[i]);
+            return status::ok;
+        }
+
+        if (cells.size() == capacity())
+            return status::full;
+
+        cells.emplace_back(std::forward<Arguments>(arguments)...);
+        cells_indices.push_back(t);
+        table_indices[t] = static_cast<int>(cells.size()) - 1;
+        notify_insert(t, cells.back());
+
+        return status::ok;
+    }
+
+    /// @brief Try to erase the contents of the table cell at the given position.
+    /// @param row The row index of the desired table cell.
+    /// @param column The column index of the desired table cell.
+    /// @return `status::ok` if the cell was erased, `status::out_of_range` if the position is invalid,
+    /// or `status::empty` if the cell was already empty.
+    /// @note This never allocates memory and the amount of time required is constant, plus the time required by each policy.
+
+    inline status try_erase(int const row, int const column) noexcept(nothrow_movable && nothrow_policies) {
+        if (!inside(row, column))
+            return status::out_of_range;
+
+        return clear(get_table_index(row, column)) ? status::ok : status::empty;
+    }
+
+    /// @brief Get a pointer to the contents of the table cell at the given position without throwing.
+    /// @return A pointer to the contents of the cell, or `nullptr` if the cell is empty or the position is invalid.
+
+    inline value_type* try_get(int const row, int const column) noexcept {
+        return inside(row, column) ? const_cast<value_type*>(find(get_table_index(row, column))) : nullptr;
+    }
+
+    /// @brief Get a pointer to the contents of the table cell at the given position without throwing.
+    /// @return A pointer to the contents of the cell, or `nullptr` if the cell is empty or the position is invalid.
+
+    inline value_type const* try_get(int const row, int const column) const noexcept {
+        return inside(row, column) ? find(get_table_index(row, column)) : nullptr;
+    }
+
+    /// @brief Get pointers to the contents of the table cells at each of the given positions without throwing.
+    /// @param positions The (row, column) positions of the desired table cells.
+    /// @param count The number of positions.
+    /// @param results The array into which a pointer to the contents of each cell should be written, which is
+    /// `nullptr` if the cell is empty or the position is invalid.
+    /// @note Lookups are resolved in batches of `prefetch_batch` positions. The lookup table slots of a batch are
+    /// prefetched first, then its data items, and then the results are written, so that the cache misses of
+    /// independent lookups overlap. This is faster than a loop of `get` when the table exceeds the cache.
+
+    void get_many(std::pair<int, int> const* positions, std::size_t const count, value_type const** results) const noexcept {
+        auto constexpr batch = static_cast<std::size_t>(prefetch_batch);
+        int slots[batch];
+
+        for (auto first = std::size_t {0}; first < count; first += batch) {
+            auto const n = std::min(batch, count - first);
+
+            for (auto k = std::size_t {0}; k < n; ++k) {
+                auto const [row, column] = positions[first + k];
+                slots[k] = inside(row, column) ? get_table_index(row, column) : none;
+                prefetch(table_indices.data() + (slots[k] == none ? 0 : slots[k]));
+            }
+
+            for (auto k = std::size_t {0}; k < n; ++k) {
+                slots[k] = slots[k] == none ? none : table_indices[slots[k]];
+                prefetch(cells.data() + (slots[k] == none ? 0 : slots[k]));
+            }
+
+            for (auto k = std::size_t {0}; k < n; ++k) {
+                results[first + k] = slots[k] == none ? nullptr : cells.data() + slots[k];
+            }
+        }
+    }
+
+    /// @brief Get pointers to the contents of the table cells at each of the given positions without throwing.
+    /// @see `ds::table::get_many`
+
+    void get_many(std::pair<int, int> const* positions, std::size_t const count, value_type** results) noexcept {
+        get_many(positions, count, const_cast<value_type const**>(results));
+    }
+
+    /// @brief Get the number of data items that the table can hold without allocating memory.
+
+    [[nodiscard]]
+    inline std::size_t capacity() const noexcept {
+        return std::min(cells.capacity(), cells_indices.capacity());
     }
 
 public:
@@ -212,14 +838,14 @@ public:
     /// but the number of items that are copied is bounded by the given dimensions.
 
     void set_size(std::size_t const number_of_rows, std::size_t const number_of_columns) {
-        ds::table<value_type> new_table(number_of_rows, number_of_columns);
+        table new_table(number_of_rows, number_of_columns);
 
         for (auto i = 0; i < cells_indices.size(); ++i) {
             auto const& index = cells_indices.at(i);
             auto const& datum = cells.at(i);
 
-            auto const row = index / cols;
-            auto const col = index % cols;
+            auto const row = logical_row(index / width);
+            auto const col = logical_column(index % width);
 
             if (row < number_of_rows && col < number_of_columns) {
                 new_table.set(row, col, datum);
@@ -229,6 +855,259 @@ public:
         *this = std::move(new_table);
     }
 
+public:
+    /// @brief Copy the occupied cells of a region of the given table into this table.
+    /// @param source The table to be copied from, which may be this table.
+    /// @param region The region of the source table to be copied, which is clipped to both tables.
+    /// @param row The row index of the cell into which the top-left cell of the region should be copied.
+    /// @param column The column index of the cell into which the top-left cell of the region should be copied.
+    /// @note Empty cells of the region are skipped, so they leave the corresponding cells of this table unchanged.
+    /// Capacity is reserved once. Runs of cells that are adjacent in both tables' arrays of data items are
+    /// copied with a single `std::copy`, which is a `memmove` for trivially copyable types, and runs of
+    /// empty destination cells are appended in bulk. If the region has more cells than the source table has
+    /// data items, the data items are visited instead of the region's cells.
+
+    template<typename... source_policies>
+    void blit(table<value_type, source_policies...> const& source, rect region, int const row, int const column) {
+        if (static_cast<void const*>(&source) == static_cast<void const*>(this)) {
+            auto const copy = source;
+            return blit(copy, region, row, column);
+        }
+
+        auto const top = std::max({0, region.row, region.row - row});
+        auto const left = std::max({0, region.column, region.column - column});
+        auto const bottom = std::min({static_cast<int>(source.height), region.row + region.rows, static_cast<int>(height) + region.row - row});
+        auto const right = std::min({static_cast<int>(source.width), region.column + region.cols, static_cast<int>(width) + region.column - column});
+
+        if (top >= bottom || left >= right)
+            return;
+
+        auto const dy = row - region.row;
+        auto const dx = column - region.column;
+        auto const area = static_cast<std::size_t>(bottom - top) * static_cast<std::size_t>(right - left);
+        grow(cells.size() + std::min(area, source.count()));
+
+        if (area > source.count()) {
+            for (auto i = std::size_t {0}; i < source.count(); ++i) {
+                auto const t = source.cells_indices[i];
+                auto const y = source.logical_row(t / static_cast<int>(source.width));
+                auto const x = source.logical_column(t % static_cast<int>(source.width));
+
+                if (y >= top && y < bottom && x >= left && x < right)
+                    copy_run(source.cells.data() + i, 1, y + dy, x + dx);
+            }
+
+            return;
+        }
+
+        for (auto y = top; y < bottom; ++y) {
+            for (auto x = left; x < right;) {
+                auto const s = source.table_indices[source.get_table_index(y, x)];
+                if (s == none) {
+                    ++x;
+                    continue;
+                }
+
+                auto const d = table_indices[get_table_index(y + dy, x + dx)];
+                auto n = 1;
+
+                while (x + n < right) {
+                    auto const s_next = source.table_indices[source.get_table_index(y, x + n)];
+                    auto const d_next = table_indices[get_table_index(y + dy, x + dx + n)];
+
+                    if (s_next != s + n || d_next != (d == none ? none : d + n))
+                        break;
+
+                    ++n;
+                }
+
+                copy_run(source.cells.data() + s, n, y + dy, x + dx);
+                x = x + n;
+            }
+        }
+    }
+
+    /// @brief Set the value of every cell of the given region.
+    /// @param region The region to be filled, which is clipped to the table.
+    /// @param element The element that should be copied into each cell.
+    /// @note Capacity is reserved once, and the amount of time required is linear in the area of the region.
+
+    void fill(rect const region, value_type const element) {
+        auto const top = std::max(0, region.row);
+        auto const left = std::max(0, region.column);
+        auto const bottom = std::min(static_cast<int>(height), region.row + region.rows);
+        auto const right = std::min(static_cast<int>(width), region.column + region.cols);
+
+        if (top >= bottom || left >= right)
+            return;
+
+        grow(cells.size() + static_cast<std::size_t>(bottom - top) * static_cast<std::size_t>(right - left));
+
+        for (auto y = top; y < bottom; ++y) {
+            for (auto x = left; x < right; ++x) {
+                copy_run(&element, 1, y, x);
+            }
+        }
+    }
+
+    /// @brief Erase the contents of every cell of the given region.
+    /// @param region The region to be cleared, which is clipped to the table.
+    /// @note The amount of time required is linear in the smaller of the area of the region and the number of data items.
+
+    void clear(rect const region) {
+        auto const top = std::max(0, region.row);
+        auto const left = std::max(0, region.column);
+        auto const bottom = std::min(static_cast<int>(height), region.row + region.rows);
+        auto const right = std::min(static_cast<int>(width), region.column + region.cols);
+
+        if (top >= bottom || left >= right)
+            return;
+
+        auto const area = static_cast<std::size_t>(bottom - top) * static_cast<std::size_t>(right - left);
+
+        if (area > cells.size()) {
+            for (auto i = static_cast<int>(cells.size()) - 1; i >= 0; --i) {
+                auto const t = cells_indices[i];
+                auto const y = logical_row(t / static_cast<int>(width));
+                auto const x = logical_column(t % static_cast<int>(width));
+
+                if (y >= top && y < bottom && x >= left && x < right)
+                    clear(t);
+            }
+
+            return;
+        }
+
+        for (auto y = top; y < bottom; ++y) {
+            for (auto x = left; x < right; ++x) {
+                clear(get_table_index(y, x));
+            }
+        }
+    }
+
+public:
+    /// @brief Invoke the given task with the column index and contents of each occupied cell of the given row.
+    /// @param row The row index of the desired row.
+    /// @param task A function with the signature `void(int column, value_type const& value)`.
+    /// @note The cells are visited in column order. With the `ds::row_index` policy, the amount of
+    /// time required is proportional to cols / 64 plus the number of items in the row; otherwise, it's linear in cols.
+
+    template<typename task_function>
+    inline void for_each_in_row(int const row, task_function&& task) const {
+        auto const physical = physical_row(row);
+        auto const base = static_cast<std::size_t>(physical) * width;
+
+        if constexpr (has_policy<row_index>) {
+            policy<row_index>().for_each_in_row(physical, [&](int const column) {
+                task(logical_column(column), cells[table_indices[base + column]]);
+            }, origin_column);
+        } else {
+            for (auto column = 0; column < static_cast<int>(width); ++column) {
+                auto const i = table_indices[base + physical_column(column)];
+                if (i != none)
+                    task(column, cells[i]);
+            }
+        }
+    }
+
+    /// @brief Invoke the given task with the row index and contents of each occupied cell of the given column.
+    /// @param column The column index of the desired column.
+    /// @param task A function with the signature `void(int row, value_type const& value)`.
+    /// @note The cells are visited in row order. With the `ds::column_index` policy, the amount of
+    /// time required is proportional to rows / 64 plus the number of items in the column; otherwise, it's linear in rows.
+
+    template<typename task_function>
+    inline void for_each_in_column(int const column, task_function&& task) const {
+        auto const physical = physical_column(column);
+
+        if constexpr (has_policy<column_index>) {
+            policy<column_index>().for_each_in_column(physical, [&](int const row) {
+                task(logical_row(row), cells[table_indices[static_cast<std::size_t>(row) * width + physical]]);
+            }, origin_row);
+        } else {
+            for (auto row = 0; row < static_cast<int>(height); ++row) {
+                auto const i = table_indices[static_cast<std::size_t>(physical_row(row)) * width + physical];
+                if (i != none)
+                    task(row, cells[i]);
+            }
+        }
+    }
+
+    /// @brief Invoke the given task with the position and contents of each occupied cell in row-major order.
+    /// @param task A function with the signature `void(int row, int column, value_type const& value)`.
+    /// @see `ds::table::for_each_in_row`
+
+    template<typename task_function>
+    inline void for_each_in_row_major_order(task_function&& task) const {
+        for (auto row = 0; row < static_cast<int>(height); ++row) {
+            for_each_in_row(row, [&](int const column, value_type const& value) {
+                task(row, column, value);
+            });
+        }
+    }
+
+    /// @brief Get the number of occupied cells in the given row.
+    /// @param row The row index of the desired row.
+    /// @note With the `ds::occupancy_counts` policy, this takes constant time; otherwise, it's linear in cols.
+
+    [[nodiscard]]
+    inline int count_in_row(int const row) const {
+        if constexpr (has_policy<occupancy_counts>) {
+            return policy<occupancy_counts>().count_in_row(physical_row(row));
+        } else {
+            auto const first = table_indices.begin() + static_cast<std::ptrdiff_t>(physical_row(row) * width);
+            return static_cast<int>(width) - static_cast<int>(std::count(first, first + width, none));
+        }
+    }
+
+    /// @brief Get the number of occupied cells in the given column.
+    /// @param column The column index of the desired column.
+    /// @note With the `ds::occupancy_counts` policy, this takes constant time; otherwise, it's linear in rows.
+
+    [[nodiscard]]
+    inline int count_in_column(int const column) const {
+        if constexpr (has_policy<occupancy_counts>) {
+            return policy<occupancy_counts>().count_in_column(physical_column(column));
+        } else {
+            auto count = 0;
+            for (auto row = std::size_t {0}; row < height; ++row) {
+                count += table_indices[row * width + physical_column(column)] != none;
+            }
+
+            return count;
+        }
+    }
+
+    /// @brief Find the position of the cell that holds the given key using the given reverse index policy.
+    /// @tparam index_type The `ds::reverse_index` policy to be used.
+    /// @param key The key of the desired data item.
+    /// @return The (row, column) position of the cell that holds the key, or `std::nullopt` if there is none.
+    /// @note The amount of time required is constant on average.
+
+    template<typename index_type, typename key_type>
+    [[nodiscard]]
+    inline std::optional<std::pair<int, int>> position_of(key_type const& key) const {
+        auto const position = policy<index_type>().find(key);
+        if (!position)
+            return std::nullopt;
+
+        return std::make_pair(logical_row(position->first), logical_column(position->second));
+    }
+
+    /// @brief Get one of the table's policies.
+    /// @tparam policy_type The type of the desired policy.
+
+    template<typename policy_type>
+    [[nodiscard]]
+    inline policy_type const& policy() const noexcept {
+        return std::get<policy_type>(extensions);
+    }
+
+    /// @brief Indicate whether the table maintains the given policy or not.
+
+    template<typename policy_type>
+    bool inline static constexpr has_policy {(std::is_same_v<policy_type, policies> || ...)};
+
 public:
     /// @brief Get a pointer to the underlying array of data items.
     /// @note This pointer is read-only.
@@ -251,14 +1130,165 @@ public:
         return cells.end();
     }
 
+    /// @brief Get a view of the cells of the given row.
+    /// @param row The row index of the desired row.
+    /// @return A sized, random-access range of pointers to the contents of each cell, which are `nullptr` if the cell is empty.
+
+    inline auto row(int const row) const {
+        return indexed_view<row_accessor> {{this, row}, width};
+    }
+
+    /// @brief Get a view of the cells of the given column.
+    /// @param column The column index of the desired column.
+    /// @return A sized, random-access range of pointers to the contents of each cell, which are `nullptr` if the cell is empty.
+
+    inline auto col(int const column) const {
+        return indexed_view<column_accessor> {{this, column}, height};
+    }
+
+    /// @brief Get a view of the rows of the table.
+    /// @return A sized, random-access range of the views of each row.
+
+    inline auto rows() const {
+        return indexed_view<rows_accessor> {{this}, height};
+    }
+
+    /// @brief Get a view of the occupied cells of the table in the order of the underlying array of data items.
+    /// @return A sized, random-access range of the position and contents of each occupied cell.
+
+    inline auto occupied() const {
+        return indexed_view<cell_accessor> {{this}, cells.size()};
+    }
+
+    /// @brief Get a pointer to the lookup table of indices into the array of data items.
+    /// @note This pointer is read-only. The lookup table is row-major and empty cells contain `none`.
+    /// After `scroll`, the lookup table is rotated so that the cell at (0, 0) lies at `origin()`.
+
+    inline auto lookup() const {
+        return table_indices.data();
+    }
+
+    /// @brief Get a pointer to the table indices of the data items, which is parallel to `data()`.
+    /// @note This pointer is read-only. The table indices are physical positions in the lookup table.
+
+    inline auto indices() const {
+        return cells_indices.data();
+    }
+
+private:
+    struct row_accessor {
+        table const* source;
+        int row;
+
+        inline value_type const* operator()(std::size_t const column) const {
+            return source->find(source->get_table_index(row, static_cast<int>(column)));
+        }
+    };
+
+    struct column_accessor {
+        table const* source;
+        int column;
+
+        inline value_type const* operator()(std::size_t const row) const {
+            return source->find(source->get_table_index(static_cast<int>(row), column));
+        }
+    };
+
+    struct rows_accessor {
+        table const* source;
+
+        inline auto operator()(std::size_t const row) const {
+            return source->row(static_cast<int>(row));
+        }
+    };
+
+    struct cell_accessor {
+        table const* source;
+
+        inline cell<value_type> operator()(std::size_t const i) const {
+            auto const t = source->cells_indices[i];
+            auto const w = static_cast<int>(source->width);
+            return {source->logical_row(t / w), source->logical_column(t % w), source->cells[i]};
+        }
+    };
+
 private:
+    /// @brief Get a pointer to the contents of the cell with the given 1d table index without bounds checking.
+    /// @return A pointer to the contents of the cell, or `nullptr` if it's empty.
+
+    [[nodiscard]]
+    inline value_type const* find(int const table_index) const noexcept {
+        auto const i = table_indices[table_index];
+        return (i == none) ? nullptr : cells.data() + i;
+    }
+
+    /// @brief Indicate whether the given 2d position lies within the table or not.
+
+    [[nodiscard]]
+    inline bool inside(int const row, int const column) const noexcept {
+        return row >= 0 && column >= 0 && row < static_cast<int>(height) && column < static_cast<int>(width);
+    }
+
+    /// @brief Whether moving a data item can throw or not.
+
+    bool inline static constexpr nothrow_movable {
+        std::is_nothrow_move_constructible_v<value_type> && std::is_nothrow_move_assignable_v<value_type>
+    };
+
+    /// @brief Whether notifying the policies of an insertion or an erasure can throw or not, such as when a policy allocates.
+
+    bool inline static constexpr nothrow_policies {
+        ((noexcept(std::declval<policies&>().insert(0, 0, std::declval<value_type const&>())) &&
+          noexcept(std::declval<policies&>().erase(0, 0, std::declval<value_type const&>()))) && ...)
+    };
+
     /// @brief Compute a 1d table index from the given 2d position.
     /// @param row The row index of the desired table cell.
     /// @param column The column index of the desired table cell.
 
     [[nodiscard]]
     inline int get_table_index(int const row, int const column) const noexcept {
-        return row * cols + column;
+        return physical_row(row) * width + physical_column(column);
+    }
+
+    /// @brief Map the given row index to its physical row in the ring-buffered lookup table.
+    /// @note Rows outside of the table remain outside of the table.
+
+    [[nodiscard]]
+    inline int physical_row(int const row) const noexcept {
+        auto const h = static_cast<int>(height);
+        if (row < 0 || row >= h)
+            return row;
+
+        auto const r = row + origin_row;
+        return r >= h ? r - h : r;
+    }
+
+    /// @brief Map the given column index to its physical column in the ring-buffered lookup table.
+    /// @note Columns outside of the table remain outside of the table.
+
+    [[nodiscard]]
+    inline int physical_column(int const column) const noexcept {
+        auto const w = static_cast<int>(width);
+        if (column < 0 || column >= w)
+            return column;
+
+        auto const c = column + origin_column;
+        return c >= w ? c - w : c;
+    }
+
+    /// @brief Map the given physical row of the lookup table to its row index.
+
+    [[nodiscard]]
+    inline int logical_row(int const row) const noexcept {
+        return row >= origin_row ? row - origin_row : row - origin_row + static_cast<int>(height);
+    }
+
+    /// @brief Map the given physical column of the lookup table to its column index.
+
+    [[nodiscard]]
+    inline int logical_column(int const column) const noexcept {
+        return column >= origin_column ? column - origin_column : column - origin_column + static_cast<int>(width);
     }
 
     /// @brief Indicate whether the element at the given 1d table index is `none` or not.
@@ -271,14 +1301,101 @@ private:
     }
 
     /// @brief Set the value of the `cells` element with the given index.
+    /// @param table_index The 1d table index of the table cell that holds the element.
     /// @param cells_index The index of the element to be modified.
     /// @param new_value The new value to be set.
 
-    inline value_type& modify(int const cells_index, value_type new_value) noexcept(false) {
-        cells.at(cells_index) = std::move(new_value);
+    inline value_type& modify(int const table_index, int const cells_index, value_type new_value) noexcept(false) {
+        notify_erase(table_index, cells.at(cells_index));
+        cells[cells_index] = std::move(new_value);
+        notify_insert(table_index, cells[cells_index]);
         return cells[cells_index];
     }
 
+    /// @brief Copy a run of elements into the given number of consecutive cells of a row, starting at the given position.
+    /// @note The cells must either be empty, in which case the elements are appended in bulk, or hold
+    /// consecutive data items, in which case the elements are copied over them in bulk.
+
+    inline void copy_run(value_type const* elements, int const n, int const row, int const column) {
+        auto const first = table_indices[get_table_index(row, column)];
+
+        if (first == none) {
+            auto const base = static_cast<int>(cells.size());
+            cells.insert(cells.end(), elements, elements + n);
+
+            for (auto k = 0; k < n; ++k) {
+                auto const t = get_table_index(row, column + k);
+                cells_indices.push_back(t);
+                table_indices[t] = base + k;
+                notify_insert(t, cells[base + k]);
+            }
+
+            return;
+        }
+
+        for (auto k = 0; k < n; ++k) {
+            notify_erase(get_table_index(row, column + k), cells[first + k]);
+        }
+
+        std::copy(elements, elements + n, cells.begin() + first);
+
+        for (auto k = 0; k < n; ++k) {
+            notify_insert(get_table_index(row, column + k), cells[first + k]);
+        }
+    }
+
+    /// @brief Reserve capacity for at least the given number of data items, growing geometrically so that
+    /// a sequence of small bulk insertions reallocates a logarithmic number of times.
+
+    inline void grow(std::size_t const needed) {
+        if (needed > capacity())
+            reserve(std::max(needed, 2 * capacity()));
+    }
+
+    /// @brief Erase the contents of the cell with the given 1d table index, if any, without bounds checking.
+    /// @return Whether the cell contained a data item or not.
+
+    inline bool clear(int const table_index) noexcept(nothrow_movable && nothrow_policies) {
+        auto const i = table_indices[table_index];
+        if (i == none)
+            return false;
+
+        notify_erase(table_index, cells[i]);
+
+        auto const last = static_cast<int>(cells.size()) - 1;
+        if (i != last) {
+            cells[i] = std::move(cells[last]);
+            cells_indices[i] = cells_indices[last];
+            table_indices[cells_indices[i]] = i;
+        }
+
+        cells.pop_back();
+        cells_indices.pop_back();
+        table_indices[table_index] = none;
+
+        return true;
+    }
+
+    /// @brief Notify each policy that an item has been inserted at the given 1d table index.
+
+    inline void notify_insert(int const table_index, value_type const& value) noexcept(nothrow_policies) {
+        if constexpr (sizeof...(policies) > 0) {
+            auto const row = table_index / static_cast<int>(width);
+            auto const column = table_index % static_cast<int>(width);
+            std::apply([&](auto&... policy) { (policy.insert(row, column, value), ...); }, extensions);
+        }
+    }
+
+    /// @brief Notify each policy that the item at the given 1d table index is about to be erased.
+
+    inline void notify_erase(int const table_index, value_type const& value) noexcept(nothrow_policies) {
+        if constexpr (sizeof...(policies) > 0) {
+            auto const row = table_index / static_cast<int>(width);
+            auto const column = table_index % static_cast<int>(width);
+            std::apply([&](auto&... policy) { (policy.erase(row, column, value), ...); }, extensions);
+        }
+    }
+
     /// @brief Swap the element at the given index with the last element in the
     /// given container and erase it.
     /// @param container The container from which the selected element should be erased.
@@ -310,6 +1427,14 @@ public:
 
     std::size_t static constexpr default_size {4};
 
+    /// @brief The number of positions whose lookups `get_many` prefetches together.
+
+    int static constexpr prefetch_batch {64};
+
+    /// @brief The value reserved to represent the absence of data in the table.
+
+    auto inline static constexpr none {-INT_MAX};
+
 private:
     /// @brief The data items that comprise the table's contents.
 
@@ -324,15 +1449,98 @@ private:
 
     std::vector<int> table_indices;
 
+    template<typename, typename...>
+    friend class table;
+
 private:
-    std::size_t rows;
-    std::size_t cols;
+    std::size_t height;
+    std::size_t width;
 
-    /// @brief The value reserved to represent the absence of data in the table.
+    /// @brief The physical position of the cell at (0, 0) in the ring-buffered lookup table.
 
-    auto inline static constexpr none {-INT_MAX};
+    int origin_row {0};
+    int origin_column {0};
+
+    /// @brief The policies that maintain auxiliary indices over the table's cells.
+
+    std::tuple<policies...> extensions;
 };
 
+/// @brief Whether the given table type can be scrolled, so that its lookup table may be rotated away from its positions.
+
+template<typename grid, typename = void>
+bool inline constexpr is_scrollable {false};
+
+template<typename grid>
+bool inline constexpr is_scrollable<grid, std::void_t<decltype(std::declval<grid const&>().origin())>> {true};
+
+/// @class Ring layout
+/// @brief The mapping between the positions of a table and the physical positions of its lookup table and of the
+/// table indices of its data items, which are rotated by the table's origin once the table has been scrolled.
+/// @note The companion headers read `lookup()` and `indices()` through this mapping, so a scrolled table costs
+/// them an addition and a comparison per access rather than a copy.
+
+struct ring_layout {
+    int rows;
+    int cols;
+    int origin_row;
+    int origin_column;
+
+    /// @brief Get the physical row of the given row, which must lie inside the table.
+
+    [[nodiscard]]
+    inline int physical_row(int const row) const noexcept {
+        auto const r = row + origin_row;
+        return r >= rows ? r - rows : r;
+    }
+
+    /// @brief Get the physical column of the given column, which must lie inside the table.
+
+    [[nodiscard]]
+    inline int physical_column(int const column) const noexcept {
+        auto const c = column + origin_column;
+        return c >= cols ? c - cols : c;
+    }
+
+    /// @brief Get the index into the lookup table of the cell at the given position, which must lie inside the table.
+
+    [[nodiscard]]
+    inline int index(int const row, int const column) const noexcept {
+        return physical_row(row) * cols + physical_column(column);
+    }
+
+    /// @brief Get the position of the cell at the given index into the lookup table.
+    /// @return The position of the cell, (row, column).
+
+    [[nodiscard]]
+    inline std::pair<int, int> position(int const index) const noexcept {
+        auto const r = index / cols - origin_row;
+        auto const c = index % cols - origin_column;
+        return {r < 0 ? r + rows : r, c < 0 ? c + cols : c};
+    }
+};
+
+/// @brief Get the mapping between the positions of the given table and the physical positions of its lookup table.
+
+template<typename grid>
+[[nodiscard]]
+inline ring_layout layout_of(grid const& table) noexcept {
+    auto const [rows, cols] = table.dimensions();
+    auto origin = std::pair<int, int> {0, 0};
+    if constexpr (is_scrollable<grid>)
+        origin = table.origin();
+
+    return {static_cast<int>(rows), static_cast<int>(cols), origin.first, origin.second};
+}
+
 }
 
+#if __cplusplus >= 202002L && __has_include(<ranges>)
+template<typename accessor>
+inline constexpr bool std::ranges::enable_borrowed_range<ds::indexed_view<accessor>> = true;
+
+template<typename accessor>
+inline constexpr bool std::ranges::enable_view<ds::indexed_view<accessor>> = true;
+#endif
+
 #endif
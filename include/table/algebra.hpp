@@ -0,0 +1,225 @@
+#ifndef TABLE_ALGEBRA_HPP
+#define TABLE_ALGEBRA_HPP
+
+#include <vector>
+#include <algorithm>
+#include <cstdint>
+#include <cstddef>
+#include <utility>
+#include <stdexcept>
+#include <type_traits>
+
+#include "../table.hpp"
+
+namespace ds {
+
+/// @class Set algebra
+/// @brief Intersections, unions and differences of the occupied cells of tables with equal dimensions.
+/// @note The occupancy of each operand is packed into a bitmap of 64 cells per word with a branch-free pass
+/// over the sign bits of its lookup table, which the compiler can vectorise. The operands are then combined with word-wide AND, OR and AND-NOT, and the data items
+/// of the result are gathered from the set bits in row-major order. The bitmaps are retained between calls.
+
+class set_algebra {
+public:
+    /// @brief Write the cells that are occupied in both tables to the target table.
+    /// @param merge A function that maps the contents of a cell in `a` and in `b` to the contents of the cell in the target.
+    /// @throws `std::invalid_argument` if the tables' dimensions differ or the target is one of the operands.
+
+    template<typename table_a, typename table_b, typename target_table, typename merge_function>
+    void intersect(table_a const& a, table_b const& b, target_table& target, merge_function&& merge) {
+        combine(a, b, target, [](auto x, auto y) { return x & y; }, [&](auto const* x, auto const* y) {
+            return merge(*x, *y);
+        });
+    }
+
+    /// @brief Write the cells that are occupied in either table to the target table.
+    /// @param merge A function that maps the contents of a cell in `a` and in `b` to the contents of the
+    /// cell in the target, which is used when the cell is occupied in both tables.
+    /// @throws `std::invalid_argument` if the tables' dimensions differ or the target is one of the operands.
+
+    template<typename table_a, typename table_b, typename target_table, typename merge_function>
+    void unite(table_a const& a, table_b const& b, target_table& target, merge_function&& merge) {
+        using value_type = std::decay_t<decltype(*target.data())>;
+        combine(a, b, target, [](auto x, auto y) { return x | y; }, [&](auto const* x, auto const* y) -> value_type {
+            return x && y ? merge(*x, *y) : x ? *x : *y;
+        });
+    }
+
+    /// @brief Write the cells of `a` that are not occupied in `b` to the target table.
+    /// @throws `std::invalid_argument` if the tables' dimensions differ or the target is one of the operands.
+
+    template<typename table_a, typename table_b, typename target_table>
+    void subtract(table_a const& a, table_b const& b, target_table& target) {
+        combine(a, b, target, [](auto x, auto y) { return x & ~y; }, [](auto const* x, auto const*) {
+            return *x;
+        });
+    }
+
+private:
+    /// @brief Pack the occupancy of the given table into the given bitmap, with `words_per_row` words per row.
+    /// @note The rows of a scrolled table are packed in their physical order and then rotated into place.
+
+    template<typename grid>
+    void pack(grid const& table, std::vector<std::uint64_t>& bits) {
+        auto const [rows, cols] = table.dimensions();
+        auto const lookup = table.lookup();
+        auto const layout = layout_of(table);
+        auto const shift = static_cast<std::size_t>(layout.origin_column);
+
+        bits.resize(rows * words_per_row);
+        rotated.resize(words_per_row);
+
+        for (auto row = std::size_t {0}; row < rows; ++row) {
+            auto const cells = lookup + static_cast<std::size_t>(layout.physical_row(static_cast<int>(row))) * cols;
+            auto const words = shift == 0 ? bits.data() + row * words_per_row : rotated.data();
+
+            for (auto w = std::size_t {0}; w < cols / 64; ++w) {
+                auto const block = cells + w * 64;
+                auto word = std::uint64_t {0};
+
+                for (auto b = 0; b < 8; ++b) {
+                    auto byte = std::uint64_t {0};
+                    for (auto k = 0; k < 8; ++k) {
+                        byte |= static_cast<std::uint64_t>(~static_cast<std::uint32_t>(block[b * 8 + k]) >> 31) << k;
+                    }
+
+                    word |= byte << (8 * b);
+                }
+
+                words[w] = word;
+            }
+
+            if (auto const tail = cols % 64; tail != 0) {
+                auto word = std::uint64_t {0};
+                for (auto k = std::size_t {0}; k < tail; ++k) {
+                    word |= static_cast<std::uint64_t>(cells[cols - tail + k] >= 0) << k;
+                }
+
+                words[cols / 64] = word;
+            }
+
+            if (shift != 0)
+                rotate(rotated.data(), bits.data() + row * words_per_row, cols, shift);
+        }
+    }
+
+    /// @brief Write the first `cols` bits of the source row to the target row, rotated towards bit 0 by the given number of bits.
+
+    static void rotate(std::uint64_t const* source, std::uint64_t* target, std::size_t const cols, std::size_t const shift) noexcept {
+        auto const extract = [&](std::size_t const p, std::size_t const n) {
+            auto const s = p % 64;
+            auto word = source[p / 64] >> s;
+            if (s != 0 && s + n > 64)
+                word |= source[p / 64 + 1] << (64 - s);
+
+            return n == 64 ? word : word & ((std::uint64_t {1} << n) - 1);
+        };
+
+        for (auto first = std::size_t {0}; first < cols; first += 64) {
+            auto const n = std::min<std::size_t>(64, cols - first);
+            auto const p = (first + shift) % cols;
+            auto const head = std::min(n, cols - p);
+
+            auto word = extract(p, head);
+            if (head < n)
+                word |= extract(0, n - head) << head;
+
+            target[first / 64] = word;
+        }
+    }
+
+    template<typename table_a, typename table_b, typename target_table, typename word_function, typename value_function>
+    void combine(table_a const& a, table_b const& b, target_table& target, word_function&& op, value_function&& value) {
+        if (a.dimensions() != b.dimensions())
+            throw std::invalid_argument("ds::set_algebra: the tables' dimensions differ");
+
+        if (static_cast<void const*>(&target) == static_cast<void const*>(&a) ||
+            static_cast<void const*>(&target) == static_cast<void const*>(&b))
+            throw std::invalid_argument("ds::set_algebra: the target table must not be an operand");
+
+        auto const [rows, cols] = a.dimensions();
+        words_per_row = (cols + 63) / 64;
+
+        pack(a, bits_a);
+        pack(b, bits_b);
+
+        auto count = std::size_t {0};
+        for (auto w = std::size_t {0}; w < bits_a.size(); ++w) {
+            bits_a[w] = op(bits_a[w], bits_b[w]);
+            count += static_cast<std::size_t>(popcount(bits_a[w]));
+        }
+
+        if (target.dimensions() != a.dimensions())
+            target.set_size(rows, cols);
+
+        target.reset();
+        target.reserve(count);
+
+        auto const lookup_a = a.lookup();
+        auto const lookup_b = b.lookup();
+        auto const layout_a = layout_of(a);
+        auto const layout_b = layout_of(b);
+        auto const data_a = a.data();
+        auto const data_b = b.data();
+
+        for (auto row = std::size_t {0}; row < rows; ++row) {
+            for_each_set_bit(bits_a.data() + row * words_per_row, words_per_row, [&](int const column) {
+                auto const i = lookup_a[layout_a.index(static_cast<int>(row), column)];
+                auto const j = lookup_b[layout_b.index(static_cast<int>(row), column)];
+                auto const x = i >= 0 ? data_a + i : nullptr;
+                auto const y = j >= 0 ? data_b + j : nullptr;
+                target.emplace(static_cast<int>(row), column, value(x, y));
+            });
+        }
+    }
+
+private:
+    std::vector<std::uint64_t> bits_a;
+    std::vector<std::uint64_t> bits_b;
+    std::vector<std::uint64_t> rotated;
+    std::size_t words_per_row {0};
+};
+
+/// @brief Write the cells that are occupied in both tables to the target table.
+/// @see `ds::set_algebra::intersect`
+
+template<typename table_a, typename table_b, typename target_table, typename merge_function>
+void intersect(table_a const& a, table_b const& b, target_table& target, merge_function&& merge) {
+    set_algebra().intersect(a, b, target, std::forward<merge_function>(merge));
+}
+
+/// @brief Write the cells that are occupied in both tables to the target table, with the contents of `a`.
+/// @see `ds::set_algebra::intersect`
+
+template<typename table_a, typename table_b, typename target_table>
+void intersect(table_a const& a, table_b const& b, target_table& target) {
+    set_algebra().intersect(a, b, target, [](auto const& x, auto const&) { return x; });
+}
+
+/// @brief Write the cells that are occupied in either table to the target table.
+/// @see `ds::set_algebra::unite`
+
+template<typename table_a, typename table_b, typename target_table, typename merge_function>
+void unite(table_a const& a, table_b const& b, target_table& target, merge_function&& merge) {
+    set_algebra().unite(a, b, target, std::forward<merge_function>(merge));
+}
+
+/// @brief Write the cells that are occupied in either table to the target table, preferring the contents of `a`.
+/// @see `ds::set_algebra::unite`
+
+template<typename table_a, typename table_b, typename target_table>
+void unite(table_a const& a, table_b const& b, target_table& target) {
+    set_algebra().unite(a, b, target, [](auto const& x, auto const&) { return x; });
+}
+
+/// @brief Write the cells of `a` that are not occupied in `b` to the target table.
+/// @see `ds::set_algebra::subtract`
+
+template<typename table_a, typename table_b, typename target_table>
+void subtract(table_a const& a, table_b const& b, target_table& target) {
+    set_algebra().subtract(a, b, target);
+}
+
+}
+
+#endif
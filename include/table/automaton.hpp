@@ -0,0 +1,161 @@
+#ifndef TABLE_AUTOMATON_HPP
+#define TABLE_AUTOMATON_HPP
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <utility>
+#include <stdexcept>
+#include <type_traits>
+
+#include "../table.hpp"
+
+namespace ds {
+
+/// @brief A Life-like rule, where each bit `n` indicates whether a cell with `n` live neighbours is born or survives.
+/// @example Conway's Game of Life, B3/S23, is `life_rule {0b1000, 0b1100}`.
+
+struct life_rule {
+    std::uint16_t birth;
+    std::uint16_t survival;
+
+    [[nodiscard]]
+    inline constexpr bool operator()(bool const alive, int const neighbours) const noexcept {
+        return ((alive ? survival : birth) >> neighbours) & 1;
+    }
+
+    /// @brief Conway's Game of Life, B3/S23.
+
+    [[nodiscard]]
+    inline static constexpr life_rule conway() noexcept {
+        return {0b1000, 0b1100};
+    }
+};
+
+/// @class Automaton
+/// @brief A step engine for outer-totalistic cellular automata over the occupied cells of a table.
+/// @note Each generation visits only the occupied cells and their neighbours. Neighbour counts are
+/// accumulated in a scratch buffer that is cleared through the list of touched cells, so the amount
+/// of time required by a step is linear in the number of live cells rather than in the size of the table.
+/// @note Rules under which an empty cell with no live neighbours is born, such as B0 rules, are not supported,
+/// since every untouched cell of the table would be born.
+
+class automaton {
+public:
+    /// @brief Advance the given table by one generation.
+    /// @param table The table whose occupied cells are alive.
+    /// @param rule A function that maps whether a cell is alive and its number of live neighbours, in the
+    /// Moore neighbourhood, to whether the cell is alive in the next generation.
+    /// @param spawn A function that maps the (row, column) position of a newborn cell to its contents.
+    /// @return The number of births and deaths, (births, deaths).
+    /// @throws `std::invalid_argument` if the rule gives birth to an empty cell with no live neighbours.
+
+    template<typename grid, typename rule_function, typename spawn_function>
+    std::pair<std::size_t, std::size_t> step(grid& table, rule_function&& rule, spawn_function&& spawn) {
+        if (rule(false, 0))
+            throw std::invalid_argument("ds::automaton: rules that give birth with no live neighbours are not supported");
+
+        auto const [rows_, cols_] = table.dimensions();
+        auto const rows = static_cast<int>(rows_);
+        auto const cols = static_cast<int>(cols_);
+
+        if (counts.size() != rows_ * cols_)
+            counts.assign(rows_ * cols_, 0);
+
+        touched.clear();
+        born.clear();
+        died.clear();
+
+        auto const count = table.count();
+        auto const indices = table.indices();
+        auto const lookup = table.lookup();
+        auto const layout = layout_of(table);
+
+        for (auto i = std::size_t {0}; i < count; ++i) {
+            auto const [y, x] = layout.position(indices[i]);
+
+            for (auto dy = -1; dy <= 1; ++dy) {
+                for (auto dx = -1; dx <= 1; ++dx) {
+                    if (dy == 0 && dx == 0)
+                        continue;
+
+                    auto ny = y + dy;
+                    auto nx = x + dx;
+
+                    if (toroidal) {
+                        ny = ny < 0 ? rows - 1 : ny == rows ? 0 : ny;
+                        nx = nx < 0 ? cols - 1 : nx == cols ? 0 : nx;
+                    } else if (ny < 0 || nx < 0 || ny >= rows || nx >= cols) {
+                        continue;
+                    }
+
+                    auto const u = ny * cols + nx;
+                    if (counts[u]++ == 0)
+                        touched.push_back(u);
+                }
+            }
+        }
+
+        for (auto i = std::size_t {0}; i < count; ++i) {
+            auto const [y, x] = layout.position(indices[i]);
+            auto const t = y * cols + x;
+            if (!rule(true, static_cast<int>(counts[t])))
+                died.push_back(t);
+        }
+
+        for (auto const u: touched) {
+            if (lookup[layout.index(u / cols, u % cols)] == grid::none && rule(false, static_cast<int>(counts[u])))
+                born.push_back(u);
+
+            counts[u] = 0;
+        }
+
+        for (auto const t: died) {
+            table.erase(t / cols, t % cols);
+        }
+
+        for (auto const t: born) {
+            table.set(t / cols, t % cols, spawn(t / cols, t % cols));
+        }
+
+        return {born.size(), died.size()};
+    }
+
+    /// @brief Advance the given table by one generation, where newborn cells are default-constructed.
+    /// @see `ds::automaton::step`
+
+    template<typename grid, typename rule_function>
+    std::pair<std::size_t, std::size_t> step(grid& table, rule_function&& rule) {
+        using value_type = std::decay_t<decltype(*table.data())>;
+        return step(table, rule, [](int, int) { return value_type {}; });
+    }
+
+    /// @brief Get the table indices of the cells that were born in the most recent step.
+
+    [[nodiscard]]
+    inline std::vector<int> const& births() const noexcept {
+        return born;
+    }
+
+    /// @brief Get the table indices of the cells that died in the most recent step.
+
+    [[nodiscard]]
+    inline std::vector<int> const& deaths() const noexcept {
+        return died;
+    }
+
+public:
+    /// @brief Whether the edges of the table wrap around or not.
+
+    bool toroidal {false};
+
+private:
+    std::vector<std::uint8_t> counts;
+    std::vector<int> touched;
+    std::vector<int> born;
+    std::vector<int> died;
+};
+
+}
+
+#endif
@@ -0,0 +1,267 @@
+#ifndef TABLE_BIT_TABLE_HPP
+#define TABLE_BIT_TABLE_HPP
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <cstdlib>
+#include <utility>
+#include <optional>
+#include <algorithm>
+#include <stdexcept>
+
+#include "../table.hpp"
+
+namespace ds {
+
+/// @class Bit table
+/// @brief A table of flags, such as a collision mask, which stores one bit per cell.
+/// @note Each row is padded to a whole number of 64-bit words, so that a row can be shifted a word at a time.
+/// Counting, searching and scrolling operate on whole words, and counting uses a branch-free loop
+/// that the compiler can vectorise. Unlike `ds::table<bool>`, a cell is either set or clear: there is no distinction
+/// between an empty cell and a cell that holds `false`.
+/// @example `ds::bit_table collisions(1024, 1024);`
+
+class bit_table {
+public:
+    /// @brief Construct a bit table with the given dimensions, where every cell is clear.
+    /// @param number_of_rows The desired number of rows.
+    /// @param number_of_cols The desired number of columns.
+
+    bit_table(std::size_t const number_of_rows, std::size_t const number_of_cols):
+            height(number_of_rows),
+            width(number_of_cols),
+            stride((number_of_cols + 63) / 64),
+            words(number_of_rows * stride, 0) {
+    }
+
+public:
+    /// @brief Get the dimensions of the table.
+    /// @return The dimensions of the table, (rows, cols).
+
+    [[nodiscard]]
+    inline std::pair<std::size_t, std::size_t> dimensions() const noexcept {
+        return {height, width};
+    }
+
+    /// @brief Get the number of set cells.
+    /// @note The amount of time required is linear in the number of words.
+
+    [[nodiscard]]
+    std::size_t count() const noexcept {
+        auto n = std::size_t {0};
+        for (auto first = std::size_t {0}; first < words.size(); first += 31) {
+            auto const last = std::min(words.size(), first + 31);
+            auto bytes = std::uint64_t {0};
+
+            for (auto w = first; w < last; ++w) {
+                auto x = words[w];
+                x = x - ((x >> 1) & 0x5555555555555555);
+                x = (x & 0x3333333333333333) + ((x >> 2) & 0x3333333333333333);
+                bytes += (x + (x >> 4)) & 0x0f0f0f0f0f0f0f0f;
+            }
+
+            bytes = (bytes & 0x00ff00ff00ff00ff) + ((bytes >> 8) & 0x00ff00ff00ff00ff);
+            bytes = (bytes & 0x0000ffff0000ffff) + ((bytes >> 16) & 0x0000ffff0000ffff);
+            n += static_cast<std::size_t>((bytes & 0xffffffff) + (bytes >> 32));
+        }
+
+        return n;
+    }
+
+    /// @brief Indicate whether any cell is set.
+
+    [[nodiscard]]
+    bool any() const noexcept {
+        auto constexpr block = std::size_t {64};
+        for (auto first = std::size_t {0}; first < words.size(); first += block) {
+            auto const last = std::min(words.size(), first + block);
+            auto bits = std::uint64_t {0};
+
+            for (auto w = first; w < last; ++w) {
+                bits |= words[w];
+            }
+
+            if (bits != 0)
+                return true;
+        }
+
+        return false;
+    }
+
+    /// @brief Indicate whether the table cell at the given position is set or not.
+    /// @throws `std::out_of_range` if the position lies outside of the table.
+
+    [[nodiscard]]
+    inline bool contains(int const row, int const column) const {
+        auto const [w, bit] = locate(row, column);
+        return (words[w] >> bit) & 1;
+    }
+
+    /// @brief Find the first set cell at or after the given position in row-major order.
+    /// @return The position of the set cell, (row, column), or `std::nullopt` if there is none.
+    /// @throws `std::out_of_range` if the position lies outside of the table.
+
+    [[nodiscard]]
+    std::optional<std::pair<int, int>> find_next(int const row, int const column) const {
+        auto const [first, bit] = locate(row, column);
+        auto word = words[first] & (~std::uint64_t {0} << bit);
+
+        for (auto w = first;;) {
+            if (word != 0) {
+                auto const r = w / stride;
+                auto const c = (w % stride) * 64 + static_cast<std::size_t>(count_trailing_zeros(word));
+                return std::make_pair(static_cast<int>(r), static_cast<int>(c));
+            }
+
+            if (++w == words.size())
+                return std::nullopt;
+
+            word = words[w];
+        }
+    }
+
+    /// @brief Invoke the given task with the position of each set cell, in row-major order.
+    /// @param task A function with the signature `void(int row, int column)`.
+
+    template<typename task_function>
+    void for_each(task_function&& task) const {
+        for (auto row = std::size_t {0}; row < height; ++row) {
+            for_each_set_bit(words.data() + row * stride, stride, [&](int const column) {
+                task(static_cast<int>(row), column);
+            });
+        }
+    }
+
+    /// @brief Get a pointer to the underlying words, where row `r` occupies `words_per_row()` words from `data() + r * words_per_row()`
+    /// and column `c` is bit `c % 64` of word `c / 64` of its row.
+
+    [[nodiscard]]
+    inline std::uint64_t const* data() const noexcept {
+        return words.data();
+    }
+
+    /// @brief Get the number of words of each row.
+
+    [[nodiscard]]
+    inline std::size_t words_per_row() const noexcept {
+        return stride;
+    }
+
+public:
+    /// @brief Set or clear the table cell at the given position.
+    /// @throws `std::out_of_range` if the position lies outside of the table.
+
+    inline void set(int const row, int const column, bool const value = true) {
+        auto const [w, bit] = locate(row, column);
+        auto const mask = std::uint64_t {1} << bit;
+        words[w] = value ? words[w] | mask : words[w] & ~mask;
+    }
+
+    /// @brief Clear the table cell at the given position.
+    /// @throws `std::out_of_range` if the position lies outside of the table.
+
+    inline void erase(int const row, int const column) {
+        set(row, column, false);
+    }
+
+    /// @brief Clear every cell.
+
+    inline void reset() noexcept {
+        std::fill(words.begin(), words.end(), 0);
+    }
+
+    /// @brief Scroll the table by the given number of rows and columns, so that the contents of the cell
+    /// at (row, column) move to (row - rows, column - columns).
+    /// @param rows The number of rows to scroll by, which is positive to scroll towards the last row.
+    /// @param columns The number of columns to scroll by, which is positive to scroll towards the last column.
+    /// @note The cells that are scrolled past the edge of the table are cleared, and the cells that are exposed
+    /// on the opposite edge are clear. Each row is moved and shifted a word at a time in a single pass.
+
+    void scroll(int const rows, int const columns) {
+        auto const h = static_cast<int>(height);
+        auto const w = static_cast<int>(width);
+
+        if (rows <= -h || rows >= h || columns <= -w || columns >= w) {
+            reset();
+            return;
+        }
+
+        auto const n = static_cast<std::size_t>(std::abs(rows));
+        auto const exposed = static_cast<std::ptrdiff_t>(n * stride);
+
+        if (rows > 0) {
+            for (auto row = std::size_t {0}; row < height - n; ++row) {
+                shift_row(words.data() + row * stride, words.data() + (row + n) * stride, columns);
+            }
+
+            std::fill(words.end() - exposed, words.end(), 0);
+        } else {
+            for (auto row = height; row-- > n;) {
+                shift_row(words.data() + row * stride, words.data() + (row - n) * stride, columns);
+            }
+
+            std::fill(words.begin(), words.begin() + exposed, 0);
+        }
+    }
+
+private:
+    /// @brief Write the bits of the source row to the target row, shifted towards bit 0 by the given number of bits,
+    /// or away from it if the number is negative. The rows may be the same row.
+
+    void shift_row(std::uint64_t* const target, std::uint64_t const* const source, int const bits) const noexcept {
+        auto const n = static_cast<std::size_t>(std::abs(bits));
+        auto const q = n / 64;
+        auto const s = n % 64;
+        auto const kept = stride - q;
+
+        if (bits >= 0) {
+            if (s == 0) {
+                std::copy(source + q, source + stride, target);
+            } else {
+                for (auto w = std::size_t {0}; w + 1 < kept; ++w) {
+                    target[w] = (source[w + q] >> s) | (source[w + q + 1] << (64 - s));
+                }
+
+                target[kept - 1] = source[stride - 1] >> s;
+            }
+
+            std::fill(target + kept, target + stride, 0);
+        } else {
+            if (s == 0) {
+                std::copy_backward(source, source + kept, target + stride);
+            } else {
+                for (auto w = stride - 1; w > q; --w) {
+                    target[w] = (source[w - q] << s) | (source[w - q - 1] >> (64 - s));
+                }
+
+                target[q] = source[0] << s;
+            }
+
+            std::fill(target, target + q, 0);
+            if (auto const tail = width % 64; tail != 0)
+                target[stride - 1] &= (std::uint64_t {1} << tail) - 1;
+        }
+    }
+
+    [[nodiscard]]
+    inline std::pair<std::size_t, int> locate(int const row, int const column) const {
+        if (row < 0 || column < 0 || row >= static_cast<int>(height) || column >= static_cast<int>(width))
+            throw std::out_of_range("ds::bit_table: position out of range");
+
+        return {static_cast<std::size_t>(row) * stride + static_cast<std::size_t>(column) / 64, column % 64};
+    }
+
+private:
+    std::size_t height;
+    std::size_t width;
+    std::size_t stride;
+
+    /// @brief The bits of each row, padded to `stride` words per row.
+
+    std::vector<std::uint64_t> words;
+};
+
+}
+
+#endif
@@ -0,0 +1,341 @@
+#ifndef TABLE_COMPONENTS_HPP
+#define TABLE_COMPONENTS_HPP
+
+#include <vector>
+#include <thread>
+#include <cstdint>
+#include <cstddef>
+#include <algorithm>
+
+#include "../table.hpp"
+
+namespace ds {
+
+/// @brief The neighbourhood used to decide whether two occupied cells are connected.
+
+enum class connectivity {
+    four = 4,
+    eight = 8
+};
+
+/// @class Labeller
+/// @brief Flood fill and connected-component labelling over the occupied cells of a table.
+/// @note The scratch buffers are retained between calls, so a labeller that is reused
+/// for tables of the same size does not allocate after its first use.
+
+class labeller {
+public:
+    /// @brief Fill the connected region of occupied cells that contains the given position.
+    /// @param source The table whose occupied cells define the regions.
+    /// @param row The row index of the seed cell.
+    /// @param column The column index of the seed cell.
+    /// @param target The companion table into which the given value should be written.
+    /// @param value The value that should be written into each cell of the region.
+    /// @param neighbourhood The connectivity of the region.
+    /// @return The number of cells in the region, which is 0 if the seed cell is empty.
+
+    template<typename source_table, typename target_table, typename value_type>
+    std::size_t flood_fill(source_table const& source, int const row, int const column,
+                           target_table& target, value_type const& value,
+                           connectivity const neighbourhood = connectivity::four) {
+        auto const [rows, cols] = source.dimensions();
+        auto const lookup = source.lookup();
+        auto const layout = layout_of(source);
+        auto const r = static_cast<int>(rows);
+        auto const c = static_cast<int>(cols);
+
+        if (row < 0 || column < 0 || row >= r || column >= c)
+            return 0;
+
+        if (lookup[layout.index(row, column)] == source_table::none)
+            return 0;
+
+        if (target.dimensions() != source.dimensions())
+            target.set_size(rows, cols);
+
+        visited.assign((rows * cols + 63) / 64, 0);
+        seeds.clear();
+        seeds.emplace_back(row, column);
+
+        auto const is_open = [&](int const y, int const x) {
+            auto const t = y * c + x;
+            return lookup[layout.index(y, x)] != source_table::none && !(visited[t >> 6] & (std::uint64_t {1} << (t & 63)));
+        };
+
+        auto const reach = neighbourhood == connectivity::eight ? 1 : 0;
+        auto filled = std::size_t {0};
+
+        while (!seeds.empty()) {
+            auto const [y, x] = seeds.back();
+            seeds.pop_back();
+
+            if (!is_open(y, x))
+                continue;
+
+            auto l = x;
+            auto h = x;
+            while (l > 0 && is_open(y, l - 1)) --l;
+            while (h < c - 1 && is_open(y, h + 1)) ++h;
+
+            for (auto x_ = l; x_ <= h; ++x_) {
+                auto const t = y * c + x_;
+                visited[t >> 6] |= std::uint64_t {1} << (t & 63);
+                target.set(y, x_, value);
+            }
+
+            filled = filled + static_cast<std::size_t>(h - l + 1);
+
+            auto const lo = std::max(0, l - reach);
+            auto const hi = std::min(c - 1, h + reach);
+
+            for (auto const y_ : {y - 1, y + 1}) {
+                if (y_ < 0 || y_ >= r)
+                    continue;
+
+                auto inside = false;
+                for (auto x_ = lo; x_ <= hi; ++x_) {
+                    auto const open = is_open(y_, x_);
+                    if (open && !inside)
+                        seeds.emplace_back(y_, x_);
+                    inside = open;
+                }
+            }
+        }
+
+        return filled;
+    }
+
+    /// @brief Label the connected components of the occupied cells of the given table.
+    /// @param source The table whose occupied cells should be labelled.
+    /// @param labels The companion table into which the labels should be written.
+    /// Each occupied cell receives a label in [1, n], numbered in row-major order of first appearance.
+    /// @param neighbourhood The connectivity of the components.
+    /// @param threads The number of horizontal tiles to label in parallel.
+    /// @return The number of connected components, n.
+
+    template<typename source_table, typename label_table>
+    std::size_t label_components(source_table const& source, label_table& labels,
+                                 connectivity const neighbourhood = connectivity::four,
+                                 std::size_t threads = 1) {
+        auto const [rows, cols] = source.dimensions();
+
+        if (labels.dimensions() != source.dimensions())
+            labels.set_size(rows, cols);
+
+        labels.reset();
+
+        threads = std::max<std::size_t>(1, std::min(threads, rows));
+        tiles.resize(threads);
+
+        if (threads == 1) {
+            scan(source, 0, static_cast<int>(rows), neighbourhood, tiles.front());
+        } else {
+            std::vector<std::thread> workers;
+            workers.reserve(threads - 1);
+
+            auto const step = rows / threads;
+            auto const bound = [&](std::size_t const k) {
+                return static_cast<int>(k == threads ? rows : k * step);
+            };
+
+            for (auto k = std::size_t {1}; k < threads; ++k) {
+                workers.emplace_back([&, k] {
+                    scan(source, bound(k), bound(k + 1), neighbourhood, tiles[k]);
+                });
+            }
+
+            scan(source, bound(0), bound(1), neighbourhood, tiles.front());
+
+            for (auto& worker: workers) {
+                worker.join();
+            }
+        }
+
+        return resolve(labels, neighbourhood);
+    }
+
+private:
+    /// @brief A maximal horizontal run of occupied cells, [begin, end), in a single row.
+
+    struct run {
+        int row;
+        int begin;
+        int end;
+        int label;
+    };
+
+    /// @brief The runs and provisional label forest of a horizontal band of rows.
+
+    struct tile {
+        std::vector<run> runs;
+        std::vector<int> parent;
+    };
+
+    /// @brief Find the root of the given label, halving the path along the way.
+
+    static int find(std::vector<int>& parent, int label) {
+        while (parent[label] != label) {
+            parent[label] = parent[parent[label]];
+            label = parent[label];
+        }
+
+        return label;
+    }
+
+    /// @brief Join the sets of the given labels, keeping the smaller label as the root.
+
+    static void unite(std::vector<int>& parent, int const a, int const b) {
+        auto const x = find(parent, a);
+        auto const y = find(parent, b);
+
+        if (x < y) parent[y] = x;
+        else if (y < x) parent[x] = y;
+    }
+
+    /// @brief Indicate whether two runs in adjacent rows are connected.
+
+    static bool touches(run const& a, run const& b, connectivity const neighbourhood) {
+        auto const reach = neighbourhood == connectivity::eight ? 1 : 0;
+        return a.begin < b.end + reach && b.begin < a.end + reach;
+    }
+
+    /// @brief Collect the runs of the rows [first, last) and unite the runs of adjacent rows.
+
+    template<typename source_table>
+    static void scan(source_table const& source, int const first, int const last,
+                     connectivity const neighbourhood, tile& band) {
+        auto const c = static_cast<int>(source.dimensions().second);
+        auto const lookup = source.lookup();
+        auto const layout = layout_of(source);
+
+        band.runs.clear();
+        band.parent.clear();
+
+        auto previous = std::size_t {0};
+
+        for (auto y = first; y < last; ++y) {
+            auto const current = band.runs.size();
+            auto const base = lookup + static_cast<std::ptrdiff_t>(layout.physical_row(y)) * c;
+            auto const occupied = [&](int const x) {
+                return base[layout.physical_column(x)] != source_table::none;
+            };
+
+            for (auto x = 0; x < c;) {
+                if (!occupied(x)) {
+                    ++x;
+                    continue;
+                }
+
+                auto const begin = x;
+                while (x < c && occupied(x)) ++x;
+
+                auto const label = static_cast<int>(band.parent.size());
+                band.parent.push_back(label);
+                band.runs.push_back({y, begin, x, label});
+            }
+
+            if (y > first) {
+                join(band.runs, previous, current, band.runs.size(), neighbourhood, band.parent);
+            }
+
+            previous = current;
+        }
+    }
+
+    /// @brief Unite the runs in [a, b) with the overlapping runs in [b, e), which must be in the next row.
+
+    static void join(std::vector<run> const& runs, std::size_t a, std::size_t b, std::size_t const e,
+                     connectivity const neighbourhood, std::vector<int>& parent) {
+        auto const middle = b;
+        while (a < middle && b < e) {
+            auto const& upper = runs[a];
+            auto const& lower = runs[b];
+
+            if (touches(upper, lower, neighbourhood))
+                unite(parent, upper.label, lower.label);
+
+            if (upper.end < lower.end) ++a;
+            else ++b;
+        }
+    }
+
+    /// @brief Merge the tiles, resolve the label forest and write the final labels.
+
+    template<typename label_table>
+    std::size_t resolve(label_table& labels, connectivity const neighbourhood) {
+        parent.clear();
+        runs.clear();
+
+        for (auto& band: tiles) {
+            auto const offset = static_cast<int>(parent.size());
+            auto const first = runs.size();
+
+            for (auto const label: band.parent) {
+                parent.push_back(label + offset);
+            }
+
+            for (auto segment: band.runs) {
+                segment.label = segment.label + offset;
+                runs.push_back(segment);
+            }
+
+            if (first > 0 && first < runs.size() && runs[first - 1].row == runs[first].row - 1) {
+                auto seam = first;
+                while (seam > 0 && runs[seam - 1].row == runs[first - 1].row) --seam;
+
+                auto end = first;
+                while (end < runs.size() && runs[end].row == runs[first].row) ++end;
+
+                join(runs, seam, first, end, neighbourhood, parent);
+            }
+        }
+
+        for (auto label = 0; label < static_cast<int>(parent.size()); ++label) {
+            parent[label] = find(parent, label);
+        }
+
+        auto count = 0;
+        for (auto label = 0; label < static_cast<int>(parent.size()); ++label) {
+            parent[label] = parent[label] == label ? ++count : parent[parent[label]];
+        }
+
+        for (auto const& segment: runs) {
+            for (auto x = segment.begin; x < segment.end; ++x) {
+                labels.set(segment.row, x, parent[segment.label]);
+            }
+        }
+
+        return static_cast<std::size_t>(count);
+    }
+
+private:
+    std::vector<std::uint64_t> visited;
+    std::vector<std::pair<int, int>> seeds;
+    std::vector<tile> tiles;
+    std::vector<run> runs;
+    std::vector<int> parent;
+};
+
+/// @brief Fill the connected region of occupied cells that contains the given position.
+/// @see `ds::labeller::flood_fill`
+
+template<typename source_table, typename target_table, typename value_type>
+std::size_t flood_fill(source_table const& source, int const row, int const column,
+                       target_table& target, value_type const& value,
+                       connectivity const neighbourhood = connectivity::four) {
+    return labeller().flood_fill(source, row, column, target, value, neighbourhood);
+}
+
+/// @brief Label the connected components of the occupied cells of the given table.
+/// @see `ds::labeller::label_components`
+
+template<typename source_table, typename label_table>
+std::size_t label_components(source_table const& source, label_table& labels,
+                             connectivity const neighbourhood = connectivity::four,
+                             std::size_t const threads = 1) {
+    return labeller().label_components(source, labels, neighbourhood, threads);
+}
+
+}
+
+#endif
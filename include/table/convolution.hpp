@@ -0,0 +1,264 @@
+#ifndef TABLE_CONVOLUTION_HPP
+#define TABLE_CONVOLUTION_HPP
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <algorithm>
+#include <stdexcept>
+#include <type_traits>
+
+#include "../table.hpp"
+
+namespace ds {
+
+/// @class Convolution
+/// @brief Separable convolution over the occupied cells of a table, where empty cells contribute zero.
+/// @note Rows whose occupancy reaches the `density` threshold are gathered into a zero-padded dense
+/// buffer and convolved with branch-free loops that the compiler can vectorise. Sparser rows scatter
+/// the contribution of each occupied cell instead. The scratch buffers are retained between calls.
+
+template<typename value_type>
+class convolution {
+public:
+    /// @brief Convolve a table with the outer product of a vertical and a horizontal kernel.
+    /// @param source The table to be filtered.
+    /// @param target The table into which the result should be written. A cell of the result is
+    /// occupied if and only if the support of the kernel, centred on it, covers an occupied source cell.
+    /// @param horizontal The odd-length kernel to be applied along each row.
+    /// @param vertical The odd-length kernel to be applied along each column.
+    /// @note The kernels are flipped, so that the result is a convolution rather than a correlation: a single occupied
+    /// source cell at (y, x) contributes `vertical[j] * horizontal[i]` times its value to the cell at (y + j - ry, x + i - rx).
+    /// The amount of time required is linear in the number of rows and columns that are reached by the kernel,
+    /// and the memory required is proportional to the vertical kernel length times the number of columns.
+    /// @throws `std::invalid_argument` if the target table is the source table, or if either kernel has an even length.
+
+    template<typename source_table, typename target_table>
+    void separable(source_table const& source, target_table& target,
+                   std::vector<value_type> const& horizontal, std::vector<value_type> const& vertical) {
+        if (static_cast<void const*>(&target) == static_cast<void const*>(&source))
+            throw std::invalid_argument("ds::convolution: the target table must not be the source table");
+
+        if (horizontal.size() % 2 == 0 || vertical.size() % 2 == 0)
+            throw std::invalid_argument("ds::convolution: the kernels must have odd lengths");
+
+        auto const [rows_, cols_] = source.dimensions();
+        rows = static_cast<int>(rows_);
+        cols = static_cast<int>(cols_);
+
+        if (target.dimensions() != source.dimensions())
+            target.set_size(rows_, cols_);
+
+        target.reset();
+        bucket(source);
+
+        row_kernel.assign(horizontal.rbegin(), horizontal.rend());
+        column_kernel.assign(vertical.rbegin(), vertical.rend());
+
+        auto const rx = static_cast<int>(horizontal.size() / 2);
+        auto const ry = static_cast<int>(vertical.size() / 2);
+        auto const window = 2 * ry + 1;
+
+        line.assign(static_cast<std::size_t>(cols + 2 * rx), value_type {});
+        line_mask.assign(static_cast<std::size_t>(cols + 2 * rx) + 1, 0);
+        ring.assign(static_cast<std::size_t>(window * cols), value_type {});
+        ring_mask.assign(static_cast<std::size_t>(window * cols), 0);
+        ring_reached.assign(static_cast<std::size_t>(window), 0);
+        output.resize(static_cast<std::size_t>(cols));
+        output_mask.resize(static_cast<std::size_t>(cols));
+
+        for (auto y = 0; y < ry && y < rows; ++y) {
+            filter_row(y);
+        }
+
+        for (auto y = 0; y < rows; ++y) {
+            if (y + ry < rows)
+                filter_row(y + ry);
+            else
+                ring_reached[(y + ry) % window] = 0;
+
+            auto reached = false;
+            for (auto j = 0; j < window; ++j) {
+                auto const h = y + j - ry;
+                reached = reached || (h >= 0 && ring_reached[h % window]);
+            }
+
+            if (!reached)
+                continue;
+
+            std::fill(output.begin(), output.end(), value_type {});
+            std::fill(output_mask.begin(), output_mask.end(), 0);
+
+            for (auto j = 0; j < window; ++j) {
+                auto const h = y + j - ry;
+                if (h < 0 || !ring_reached[h % window])
+                    continue;
+
+                auto const weight = column_kernel[j];
+                auto const in = ring.data() + (h % window) * cols;
+                auto const in_mask = ring_mask.data() + (h % window) * cols;
+
+                for (auto x = 0; x < cols; ++x) {
+                    output[x] += weight * in[x];
+                    output_mask[x] |= in_mask[x];
+                }
+            }
+
+            for (auto x = 0; x < cols; ++x) {
+                if (output_mask[x])
+                    target.set(y, x, output[x]);
+            }
+        }
+    }
+
+    /// @brief Replace each cell by the mean of the (2 * radius + 1)^2 cells around it.
+    /// @note The value type must be a floating-point type, since the weight of each cell is a fraction.
+    /// @throws `std::invalid_argument` if the radius is negative.
+    /// @see `ds::convolution::separable`
+
+    template<typename source_table, typename target_table>
+    void box(source_table const& source, target_table& target, int const radius) {
+        static_assert(std::is_floating_point_v<value_type>, "ds::convolution::box requires a floating-point type");
+
+        if (radius < 0)
+            throw std::invalid_argument("ds::convolution: the radius must not be negative");
+
+        auto const length = static_cast<std::size_t>(2 * radius + 1);
+        auto const kernel = std::vector<value_type>(length, value_type(1) / static_cast<value_type>(length));
+        separable(source, target, kernel, kernel);
+    }
+
+public:
+    /// @brief The fraction of a row that must be occupied for the row to be gathered densely.
+
+    double density {0.25};
+
+private:
+    /// @brief Sort the data items of the given table into buckets by row.
+
+    template<typename source_table>
+    void bucket(source_table const& source) {
+        auto const count = source.count();
+        auto const indices = source.indices();
+        auto const layout = layout_of(source);
+
+        row_start.assign(static_cast<std::size_t>(rows) + 1, 0);
+        for (auto i = std::size_t {0}; i < count; ++i) {
+            ++row_start[layout.position(indices[i]).first + 1];
+        }
+
+        for (auto y = 0; y < rows; ++y) {
+            row_start[y + 1] += row_start[y];
+        }
+
+        row_items.resize(count);
+        row_fill.assign(row_start.begin(), row_start.end() - 1);
+
+        auto const data = source.data();
+        for (auto i = std::size_t {0}; i < count; ++i) {
+            auto const [y, x] = layout.position(indices[i]);
+            row_items[row_fill[y]++] = {x, data[i]};
+        }
+    }
+
+    /// @brief Convolve the given row with the horizontal kernel into its slot of the ring buffer.
+
+    void filter_row(int const y) {
+        auto const& kernel = row_kernel;
+        auto const window = static_cast<int>(ring_reached.size());
+        auto const slot = y % window;
+        auto const first = row_items.begin() + row_start[y];
+        auto const last = row_items.begin() + row_start[y + 1];
+        auto const items = static_cast<int>(last - first);
+
+        ring_reached[slot] = items > 0;
+        if (items == 0)
+            return;
+
+        auto const r = static_cast<int>(kernel.size() / 2);
+        auto const length = static_cast<int>(kernel.size());
+        auto const out = ring.data() + slot * cols;
+        auto const out_mask = ring_mask.data() + slot * cols;
+
+        if (static_cast<double>(items) >= density * static_cast<double>(cols)) {
+            std::fill(line.begin(), line.end(), value_type {});
+            std::fill(line_mask.begin(), line_mask.end(), 0);
+
+            for (auto item = first; item != last; ++item) {
+                line[item->first + r] = item->second;
+                line_mask[item->first + r + 1] = 1;
+            }
+
+            for (auto x = 1; x < static_cast<int>(line_mask.size()); ++x) {
+                line_mask[x] += line_mask[x - 1];
+            }
+
+            for (auto x = 0; x < cols; ++x) {
+                auto sum = value_type {};
+                for (auto j = 0; j < length; ++j) {
+                    sum += kernel[j] * line[x + j];
+                }
+
+                out[x] = sum;
+                out_mask[x] = line_mask[x + length] != line_mask[x];
+            }
+
+            return;
+        }
+
+        std::fill(out, out + cols, value_type {});
+        std::fill(out_mask, out_mask + cols, 0);
+
+        for (auto item = first; item != last; ++item) {
+            auto const lo = std::max(0, item->first + r - (length - 1));
+            auto const hi = std::min(cols - 1, item->first + r);
+
+            for (auto x = lo; x <= hi; ++x) {
+                out[x] += kernel[item->first + r - x] * item->second;
+                out_mask[x] = 1;
+            }
+        }
+    }
+
+private:
+    std::vector<std::size_t> row_start;
+    std::vector<std::size_t> row_fill;
+    std::vector<std::pair<int, value_type>> row_items;
+
+    /// @brief The horizontal and vertical kernels, reversed.
+
+    std::vector<value_type> row_kernel;
+    std::vector<value_type> column_kernel;
+
+    std::vector<value_type> line;
+    std::vector<std::uint32_t> line_mask;
+    std::vector<value_type> ring;
+    std::vector<std::uint8_t> ring_mask;
+    std::vector<std::uint8_t> ring_reached;
+    std::vector<value_type> output;
+    std::vector<std::uint8_t> output_mask;
+
+    int rows {0};
+    int cols {0};
+};
+
+/// @brief Convolve a table with the outer product of a vertical and a horizontal kernel.
+/// @see `ds::convolution::separable`
+
+template<typename source_table, typename target_table, typename value_type>
+void convolve(source_table const& source, target_table& target,
+              std::vector<value_type> const& horizontal, std::vector<value_type> const& vertical) {
+    convolution<value_type>().separable(source, target, horizontal, vertical);
+}
+
+/// @brief Replace each cell by the mean of the (2 * radius + 1)^2 cells around it.
+/// @see `ds::convolution::box`
+
+template<typename value_type, typename source_table, typename target_table>
+void box_filter(source_table const& source, target_table& target, int const radius) {
+    convolution<value_type>().box(source, target, radius);
+}
+
+}
+
+#endif
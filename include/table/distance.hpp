@@ -0,0 +1,294 @@
+#ifndef TABLE_DISTANCE_HPP
+#define TABLE_DISTANCE_HPP
+
+#include <cmath>
+#include <limits>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <utility>
+#include <algorithm>
+
+#include "../table.hpp"
+
+namespace ds {
+
+/// @brief The distance between two cells.
+
+enum class metric {
+    euclidean,
+    chebyshev
+};
+
+/// @brief Find the occupied cell that is nearest to the given position.
+/// @param table The table to be searched.
+/// @param row The row index of the query position.
+/// @param column The column index of the query position.
+/// @param measure The metric by which distance should be measured.
+/// @return The (row, column) position of the nearest occupied cell, or (-1, -1) if the table is empty.
+/// @note The search visits square rings of cells around the query position until no closer
+/// cell can exist, falling back to a scan of the data items once the rings would visit more
+/// cells than there are items. The amount of time required is min(d^2, count) for a nearest distance d.
+
+template<typename grid>
+std::pair<int, int> nearest_occupied(grid const& table, int const row, int const column,
+                                     metric const measure = metric::euclidean) {
+    auto const [rows, cols] = table.dimensions();
+    auto const r = static_cast<int>(rows);
+    auto const c = static_cast<int>(cols);
+    auto const lookup = table.lookup();
+    auto const layout = layout_of(table);
+
+    auto best = std::pair {-1, -1};
+    auto best_distance = std::numeric_limits<std::int64_t>::max();
+
+    auto const consider = [&](int const y, int const x) {
+        auto const dy = static_cast<std::int64_t>(y - row);
+        auto const dx = static_cast<std::int64_t>(x - column);
+        auto const d = measure == metric::euclidean ? dy * dy + dx * dx : std::max(std::abs(dy), std::abs(dx));
+
+        if (d < best_distance) {
+            best_distance = d;
+            best = {y, x};
+        }
+    };
+
+    auto const visit = [&](int const y, int const x) {
+        if (y >= 0 && x >= 0 && y < r && x < c && lookup[layout.index(y, x)] != grid::none)
+            consider(y, x);
+    };
+
+    auto const count = static_cast<std::int64_t>(table.count());
+    auto const limit = std::max(std::max(row, r - 1 - row), std::max(column, c - 1 - column));
+
+    for (auto k = 0; k <= limit && count > 0; ++k) {
+        auto const ring = static_cast<std::int64_t>(k);
+        auto const done = measure == metric::euclidean ? ring * ring > best_distance : ring > best_distance;
+        if (done)
+            return best;
+
+        if ((2 * ring + 1) * (2 * ring + 1) > count)
+            break;
+
+        if (k == 0) {
+            visit(row, column);
+            continue;
+        }
+
+        for (auto x = column - k; x <= column + k; ++x) {
+            visit(row - k, x);
+            visit(row + k, x);
+        }
+
+        for (auto y = row - k + 1; y <= row + k - 1; ++y) {
+            visit(y, column - k);
+            visit(y, column + k);
+        }
+    }
+
+    auto const indices = table.indices();
+    for (auto i = std::size_t {0}; i < table.count(); ++i) {
+        auto const [y, x] = layout.position(indices[i]);
+        consider(y, x);
+    }
+
+    return best;
+}
+
+/// @class Distance field
+/// @brief The distance from every cell of a table to its nearest occupied cell.
+/// @note The Euclidean transform uses the linear-time lower envelope of parabolas of
+/// Felzenszwalb and Huttenlocher, and the Chebyshev transform uses a two-pass chamfer.
+/// Both track the nearest occupied cell, so queries take constant time once built.
+
+class distance_field {
+public:
+    /// @brief Compute the distance transform of the given table.
+    /// @param table The table whose occupied cells are the sites of the transform.
+    /// @param measure The metric by which distance should be measured.
+    /// @note The amount of time required is linear in the size of the table.
+
+    template<typename grid>
+    void build(grid const& table, metric const measure = metric::euclidean) {
+        auto const [rows_, cols_] = table.dimensions();
+        rows = static_cast<int>(rows_);
+        cols = static_cast<int>(cols_);
+        kind = measure;
+
+        auto const size = rows_ * cols_;
+        distances.assign(size, infinity);
+        sites.assign(size, none);
+
+        auto const lookup = table.lookup();
+        auto const layout = layout_of(table);
+        if (measure == metric::euclidean)
+            euclidean(lookup, layout, grid::none);
+        else
+            chebyshev(lookup, layout, grid::none);
+    }
+
+    /// @brief Get the distance from the given cell to the nearest occupied cell.
+    /// @return The distance, which is infinite if the table was empty.
+
+    [[nodiscard]]
+    inline float distance(int const row, int const column) const noexcept(false) {
+        auto const d = distances.at(row * cols + column);
+        return kind == metric::euclidean ? std::sqrt(d) : d;
+    }
+
+    /// @brief Get the position of the occupied cell that is nearest to the given cell.
+    /// @return The (row, column) position of the nearest occupied cell, or (-1, -1) if the table was empty.
+
+    [[nodiscard]]
+    inline std::pair<int, int> nearest(int const row, int const column) const noexcept(false) {
+        auto const site = sites.at(row * cols + column);
+        return site == none ? std::pair {-1, -1} : std::pair {site / cols, site % cols};
+    }
+
+    /// @brief Get the dimensions of the field.
+    /// @return The dimensions of the field, (rows, cols).
+
+    [[nodiscard]]
+    inline std::pair<std::size_t, std::size_t> dimensions() const noexcept {
+        return {static_cast<std::size_t>(rows), static_cast<std::size_t>(cols)};
+    }
+
+private:
+    /// @brief Compute the squared Euclidean transform by a pass over the columns and a pass over the rows.
+
+    void euclidean(int const* lookup, ring_layout const& layout, int const empty) {
+        for (auto x = 0; x < cols; ++x) {
+            auto site = none;
+            for (auto y = 0; y < rows; ++y) {
+                if (lookup[layout.index(y, x)] != empty) site = y;
+                sites[y * cols + x] = site;
+            }
+
+            site = none;
+            for (auto y = rows - 1; y >= 0; --y) {
+                if (lookup[layout.index(y, x)] != empty) site = y;
+
+                auto const above = sites[y * cols + x];
+                auto const nearest = site == none ? above
+                                   : above == none ? site
+                                   : (y - above <= site - y ? above : site);
+
+                sites[y * cols + x] = nearest;
+                distances[y * cols + x] = nearest == none ? infinity : squared(y - nearest);
+            }
+        }
+
+        envelope.resize(static_cast<std::size_t>(cols));
+        bounds.resize(static_cast<std::size_t>(cols) + 1);
+        row_buffer.resize(static_cast<std::size_t>(cols));
+        row_sites.resize(static_cast<std::size_t>(cols));
+
+        for (auto y = 0; y < rows; ++y) {
+            auto const f = distances.data() + y * cols;
+            auto k = -1;
+
+            for (auto q = 0; q < cols; ++q) {
+                if (f[q] == infinity)
+                    continue;
+
+                auto s = 0.0f;
+                while (k >= 0) {
+                    auto const v = envelope[k];
+                    s = ((f[q] + squared(q)) - (f[v] + squared(v))) / static_cast<float>(2 * (q - v));
+                    if (s > bounds[k]) break;
+                    --k;
+                }
+
+                ++k;
+                envelope[k] = q;
+                bounds[k] = k == 0 ? -infinity : s;
+                bounds[k + 1] = infinity;
+            }
+
+            if (k < 0)
+                continue;
+
+            for (auto j = 0, x = 0; x < cols; ++x) {
+                while (bounds[j + 1] < static_cast<float>(x)) ++j;
+                auto const v = envelope[j];
+                row_buffer[x] = squared(x - v) + f[v];
+                row_sites[x] = sites[y * cols + v] * cols + v;
+            }
+
+            for (auto x = 0; x < cols; ++x) {
+                f[x] = row_buffer[x];
+                sites[y * cols + x] = row_sites[x];
+            }
+        }
+    }
+
+    /// @brief Compute the Chebyshev transform with a forward and a backward chamfer pass.
+
+    void chebyshev(int const* lookup, ring_layout const& layout, int const empty) {
+        for (auto y = 0; y < rows; ++y) {
+            for (auto x = 0; x < cols; ++x) {
+                auto const t = y * cols + x;
+                if (lookup[layout.index(y, x)] != empty) {
+                    distances[t] = 0.0f;
+                    sites[t] = t;
+                }
+            }
+        }
+
+        auto const relax = [&](int const t, int const y, int const x) {
+            if (y < 0 || x < 0 || y >= rows || x >= cols)
+                return;
+
+            auto const u = y * cols + x;
+            if (distances[u] + 1.0f < distances[t]) {
+                distances[t] = distances[u] + 1.0f;
+                sites[t] = sites[u];
+            }
+        };
+
+        for (auto y = 0; y < rows; ++y) {
+            for (auto x = 0; x < cols; ++x) {
+                auto const t = y * cols + x;
+                relax(t, y - 1, x - 1);
+                relax(t, y - 1, x);
+                relax(t, y - 1, x + 1);
+                relax(t, y, x - 1);
+            }
+        }
+
+        for (auto y = rows - 1; y >= 0; --y) {
+            for (auto x = cols - 1; x >= 0; --x) {
+                auto const t = y * cols + x;
+                relax(t, y + 1, x + 1);
+                relax(t, y + 1, x);
+                relax(t, y + 1, x - 1);
+                relax(t, y, x + 1);
+            }
+        }
+    }
+
+    [[nodiscard]]
+    inline static float squared(int const value) noexcept {
+        return static_cast<float>(value) * static_cast<float>(value);
+    }
+
+private:
+    std::vector<float> distances;
+    std::vector<int> sites;
+
+    std::vector<int> envelope;
+    std::vector<float> bounds;
+    std::vector<float> row_buffer;
+    std::vector<int> row_sites;
+
+    int rows {0};
+    int cols {0};
+    metric kind {metric::euclidean};
+
+    auto inline static constexpr none {-1};
+    auto inline static constexpr infinity {std::numeric_limits<float>::infinity()};
+};
+
+}
+
+#endif
@@ -0,0 +1,270 @@
+#ifndef TABLE_FILE_TABLE_HPP
+#define TABLE_FILE_TABLE_HPP
+
+#include <string>
+#include <cerrno>
+#include <cstdint>
+#include <cstddef>
+#include <algorithm>
+#include <stdexcept>
+#include <system_error>
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "shared_table.hpp"
+
+namespace ds {
+
+/// @class File table
+/// @brief A mapped table in a file, whose lookup table, cell indices and cells are written in place,
+/// so that persisting the table costs an `msync` rather than a serialisation pass, and reopening it costs a mapping.
+/// @note The array of cell indices has room for every cell of the table and the file is sparse, so the table grows
+/// by extending the file with `ftruncate` and the mapping with `mremap`, without moving its cells.
+/// The header records the generation of the last `sync` and the sequence number at that point, and a dirty flag
+/// that is persisted before the first write since the last `sync`, because the kernel may write the pages back in any order.
+/// A table that is reopened while it is dirty is repaired: its lookup table is rebuilt from the cell indices, so that
+/// it is valid whichever of its pages were persisted. A clean table is trusted, unless it is opened with `verify`.
+/// @example `ds::file_table<voxel> world("world.table", 4096, 4096);`
+
+template<typename value_type>
+class file_table: public mapped_table<value_type> {
+public:
+    /// @brief Create an empty table in the file at the given path, which is created or truncated.
+    /// @param path The path of the file.
+    /// @param number_of_rows The desired number of rows.
+    /// @param number_of_cols The desired number of columns.
+    /// @param capacity The number of data items that the table can hold before the file is extended.
+    /// @throws `std::system_error` if the file cannot be created, sized or mapped.
+
+    file_table(std::string const& path, std::size_t const number_of_rows, std::size_t const number_of_cols, std::size_t const capacity = 1024) {
+        auto const reserved = number_of_rows * number_of_cols;
+        auto const initial = std::max<std::size_t>(1, std::min(capacity, reserved));
+
+        auto h = mapped_header {};
+        size = this->layout(h, number_of_rows, number_of_cols, initial, reserved);
+
+        descriptor = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+        if (descriptor < 0)
+            throw std::system_error(errno, std::generic_category(), "ds::file_table: failed to create " + path);
+
+        try {
+            resize(size);
+            map();
+        } catch (...) {
+            ::close(descriptor);
+            throw;
+        }
+
+        this->create(region, number_of_rows, number_of_cols, initial, reserved);
+        sync();
+    }
+
+    /// @brief Open the table in the existing file at the given path, repairing it if it was not synchronised when it was last closed.
+    /// @param verify Whether a clean table should also be checked, and repaired if its lookup table and cell indices disagree,
+    /// such as after the file was modified by another program. This reads the whole file.
+    /// @throws `std::system_error` if the file cannot be opened or mapped, or `std::runtime_error` if it does not hold a table of this value type.
+
+    explicit file_table(std::string const& path, bool const verify = false) {
+        descriptor = ::open(path.c_str(), O_RDWR);
+        if (descriptor < 0)
+            throw std::system_error(errno, std::generic_category(), "ds::file_table: failed to open " + path);
+
+        try {
+            struct stat status {};
+            if (::fstat(descriptor, &status) != 0)
+                throw std::system_error(errno, std::generic_category(), "ds::file_table: failed to open " + path);
+
+            size = static_cast<std::size_t>(status.st_size);
+            map();
+            this->open(region, size);
+        } catch (...) {
+            if (region != nullptr)
+                ::munmap(region, size);
+
+            ::close(descriptor);
+            throw;
+        }
+
+        if (this->header->dirty != 0 || this->unsynchronised() || (verify && !this->consistent())) {
+            this->repair();
+            repaired = true;
+            sync();
+        }
+    }
+
+    file_table(file_table const&) = delete;
+    file_table& operator=(file_table const&) = delete;
+
+    /// @brief Synchronise the table, ignoring errors, and close the file.
+
+    ~file_table() {
+        if (this->header->dirty != 0 || this->unsynchronised())
+            synchronise();
+
+        ::munmap(region, size);
+        ::close(descriptor);
+    }
+
+public:
+    /// @brief Set the value of the table cell at the given position, extending the file if the table is full.
+    /// @throws `std::out_of_range` if the position lies outside of the table, or `std::system_error` if the file cannot be extended.
+
+    void set(int const row, int const column, value_type const& element) {
+        if (!this->contains(row, column) && this->count() == this->capacity())
+            reserve(this->capacity() * 2);
+
+        touch();
+        mapped_table<value_type>::set(row, column, element);
+    }
+
+    /// @brief Erase the contents of the table cell at the given position.
+    /// @throws `std::out_of_range` if the position lies outside of the table or the cell is empty.
+
+    void erase(int const row, int const column) {
+        touch();
+        mapped_table<value_type>::erase(row, column);
+    }
+
+    /// @brief Erase every data item.
+
+    void reset() {
+        touch();
+        mapped_table<value_type>::reset();
+    }
+
+    /// @brief Invoke the given task as a single write, so that readers observe either none or all of its changes.
+    /// @param task A function with the signature `void(file_table& table)`, which may call `set`, `erase` and `reset`.
+
+    template<typename task_function>
+    void write(task_function&& task) {
+        touch();
+        mapped_table<value_type>::write([&](mapped_table<value_type>&) {
+            task(*this);
+        });
+    }
+
+    /// @brief Extend the file so that the table can hold at least the given number of data items.
+    /// @note The capacity is limited to the number of cells of the table.
+    /// @throws `std::system_error` if the file cannot be extended.
+
+    void reserve(std::size_t const capacity) {
+        auto const [rows, cols] = this->dimensions();
+        auto const target = std::min(capacity, rows * cols);
+        if (target <= this->capacity())
+            return;
+
+        touch();
+        resize(this->header->cells_offset + target * sizeof(value_type));
+        map();
+        this->header->capacity = target;
+    }
+
+    /// @brief Write the table to the file and record a new generation in its header once the table is durable.
+    /// @note The cells are synchronised before the header, so a header that records a generation describes a durable table.
+    /// @throws `std::system_error` if the file cannot be synchronised.
+
+    void sync() {
+        if (auto const error = synchronise(); error != 0)
+            throw std::system_error(error, std::generic_category(), "ds::file_table: failed to synchronise the file");
+    }
+
+    /// @brief Get the number of times that the table has been synchronised since it was created.
+
+    [[nodiscard]]
+    inline std::uint64_t generation() const noexcept {
+        return this->header->generation;
+    }
+
+    /// @brief Indicate whether the table had to be repaired when it was opened.
+
+    [[nodiscard]]
+    inline bool recovered() const noexcept {
+        return repaired;
+    }
+
+private:
+    /// @return Zero if the table was synchronised, or the `errno` of the call that failed.
+
+    int synchronise() noexcept {
+        if (::msync(region, size, MS_SYNC) != 0)
+            return errno;
+
+        this->header->generation += 1;
+        this->header->synced = this->header->sequence.load(std::memory_order_relaxed);
+        this->header->dirty = 0;
+
+        return ::msync(region, header_size(), MS_SYNC) == 0 ? 0 : errno;
+    }
+
+    /// @brief Persist the dirty flag before the first write since the table was last synchronised, so that a table
+    /// whose data pages reach the file before its header does is repaired when it is reopened.
+    /// @throws `std::system_error` if the header cannot be synchronised.
+
+    void touch() {
+        if (this->header->dirty != 0)
+            return;
+
+        this->header->dirty = 1;
+        if (::msync(region, header_size(), MS_SYNC) != 0)
+            throw std::system_error(errno, std::generic_category(), "ds::file_table: failed to synchronise the file");
+    }
+
+    /// @brief Get the number of bytes at the start of the region that are synchronised with the header, which is its page.
+
+    [[nodiscard]]
+    inline std::size_t header_size() const noexcept {
+        auto const page = static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+        return std::min(page, size);
+    }
+
+    void resize(std::size_t const bytes) {
+        if (::ftruncate(descriptor, static_cast<off_t>(bytes)) != 0)
+            throw std::system_error(errno, std::generic_category(), "ds::file_table: failed to extend the file");
+
+        mapped = size;
+        size = bytes;
+    }
+
+    /// @brief Map the file at its current size, moving the existing mapping if there is one.
+
+    void map() {
+        void* address = MAP_FAILED;
+        if (region == nullptr) {
+            address = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, descriptor, 0);
+        } else {
+#if defined(MREMAP_MAYMOVE)
+            address = ::mremap(region, mapped, size, MREMAP_MAYMOVE);
+#else
+            address = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, descriptor, 0);
+            if (address != MAP_FAILED)
+                ::munmap(region, mapped);
+#endif
+        }
+
+        if (address == MAP_FAILED) {
+            auto const error = errno;
+            if (region != nullptr)
+                size = mapped;
+
+            throw std::system_error(error, std::generic_category(), "ds::file_table: failed to map the file");
+        }
+
+        region = address;
+        if (this->header != nullptr)
+            this->attach(region);
+    }
+
+private:
+    int descriptor {-1};
+    void* region {nullptr};
+    std::size_t size {0};
+    std::size_t mapped {0};
+    bool repaired {false};
+};
+
+}
+
+#endif
@@ -0,0 +1,231 @@
+#ifndef TABLE_GENERATOR_HPP
+#define TABLE_GENERATOR_HPP
+
+#if __cplusplus < 202002L || !__has_include(<coroutine>)
+#error "table/generator.hpp requires C++20 coroutines. Link against the `table20` target."
+#endif
+
+#include <span>
+#include <vector>
+#include <memory>
+#include <cstddef>
+#include <utility>
+#include <iterator>
+#include <exception>
+#include <coroutine>
+#include <algorithm>
+#include <type_traits>
+
+#include "../table.hpp"
+
+namespace ds {
+
+/// @class Generator
+/// @brief A lazily-evaluated input range whose elements are produced by a coroutine.
+/// @note The coroutine is suspended after each `co_yield` and resumed when the range is advanced,
+/// so no intermediate container is materialised. This is a subset of C++23's `std::generator`.
+
+template<typename reference>
+class generator {
+public:
+    using value_type = std::remove_cvref_t<reference>;
+
+    struct promise_type {
+        std::add_pointer_t<reference> current {nullptr};
+        std::exception_ptr exception;
+
+        generator get_return_object() noexcept {
+            return generator {std::coroutine_handle<promise_type>::from_promise(*this)};
+        }
+
+        std::suspend_always initial_suspend() const noexcept {
+            return {};
+        }
+
+        std::suspend_always final_suspend() const noexcept {
+            return {};
+        }
+
+        std::suspend_always yield_value(std::remove_reference_t<reference>& element) noexcept {
+            current = std::addressof(element);
+            return {};
+        }
+
+        std::suspend_always yield_value(std::remove_reference_t<reference>&& element) noexcept {
+            current = std::addressof(element);
+            return {};
+        }
+
+        void return_void() const noexcept {
+        }
+
+        void unhandled_exception() noexcept {
+            exception = std::current_exception();
+        }
+
+        void await_transform() = delete;
+    };
+
+    class iterator {
+    public:
+        using value_type = generator::value_type;
+        using difference_type = std::ptrdiff_t;
+
+        iterator() = default;
+
+        explicit iterator(std::coroutine_handle<promise_type> handle) noexcept: handle(handle) {
+        }
+
+        reference operator*() const noexcept {
+            return static_cast<reference>(*handle.promise().current);
+        }
+
+        iterator& operator++() {
+            handle.resume();
+            rethrow();
+            return *this;
+        }
+
+        void operator++(int) {
+            ++*this;
+        }
+
+        friend bool operator==(iterator const& it, std::default_sentinel_t) noexcept {
+            return !it.handle || it.handle.done();
+        }
+
+    private:
+        void rethrow() const {
+            if (handle.done() && handle.promise().exception)
+                std::rethrow_exception(handle.promise().exception);
+        }
+
+        friend class generator;
+
+        std::coroutine_handle<promise_type> handle {nullptr};
+    };
+
+public:
+    generator(generator&& other) noexcept: handle(std::exchange(other.handle, nullptr)) {
+    }
+
+    generator& operator=(generator&& other) noexcept {
+        std::swap(handle, other.handle);
+        return *this;
+    }
+
+    generator(generator const&) = delete;
+    generator& operator=(generator const&) = delete;
+
+    ~generator() {
+        if (handle)
+            handle.destroy();
+    }
+
+    /// @brief Start the coroutine and get an iterator to its first element.
+    /// @note The range is single-pass, so this should be called once.
+
+    iterator begin() {
+        handle.resume();
+        auto it = iterator {handle};
+        it.rethrow();
+        return it;
+    }
+
+    std::default_sentinel_t end() const noexcept {
+        return {};
+    }
+
+private:
+    explicit generator(std::coroutine_handle<promise_type> handle) noexcept: handle(handle) {
+    }
+
+    std::coroutine_handle<promise_type> handle;
+};
+
+/// @brief Lazily produce the occupied cells of the given region that satisfy the given predicate.
+/// @param table The table to be scanned. It must outlive the generator and must not be modified during the scan.
+/// @param region The region of the table to be scanned, which is clipped to the table's dimensions.
+/// @param predicate A function that maps the contents of a cell to whether the cell should be produced.
+/// @note If the region has fewer cells than the table has data items, its rows are scanned in
+/// row-major order. Otherwise, the data items are scanned in storage order and filtered by position.
+/// The physical positions of a scrolled table are translated through its origin.
+
+template<typename grid, typename predicate_function>
+auto scan(grid const& table, rect const region, predicate_function predicate)
+        -> generator<cell<std::remove_cvref_t<decltype(*table.data())>>> {
+    auto const [rows, cols] = table.dimensions();
+    auto const r = static_cast<int>(rows);
+    auto const c = static_cast<int>(cols);
+
+    auto const top = std::max(0, region.row);
+    auto const left = std::max(0, region.column);
+    auto const bottom = std::min(r, region.row + region.rows);
+    auto const right = std::min(c, region.column + region.cols);
+
+    if (top >= bottom || left >= right)
+        co_return;
+
+    auto const data = table.data();
+    auto const area = static_cast<std::size_t>(bottom - top) * static_cast<std::size_t>(right - left);
+
+    auto const layout = layout_of(table);
+
+    if (area < table.count()) {
+        auto const lookup = table.lookup();
+        for (auto y = top; y < bottom; ++y) {
+            for (auto x = left; x < right; ++x) {
+                auto const i = lookup[layout.index(y, x)];
+                if (i != grid::none && predicate(data[i]))
+                    co_yield {y, x, data[i]};
+            }
+        }
+
+        co_return;
+    }
+
+    auto const indices = table.indices();
+    for (auto i = std::size_t {0}; i < table.count(); ++i) {
+        auto const [y, x] = layout.position(indices[i]);
+
+        if (y >= top && y < bottom && x >= left && x < right && predicate(data[i]))
+            co_yield {y, x, data[i]};
+    }
+}
+
+/// @brief Lazily produce every occupied cell of the given region.
+/// @see `ds::scan`
+
+template<typename grid>
+auto scan(grid const& table, rect const region) {
+    return scan(table, region, [](auto const&) { return true; });
+}
+
+/// @brief Lazily produce the cells of `ds::scan` in chunks, suspending between chunks.
+/// @param size The maximum number of cells per chunk.
+/// @note Each chunk is a view of a buffer that is reused by the next chunk.
+
+template<typename grid, typename predicate_function>
+auto chunks(grid const& table, rect const region, predicate_function predicate, std::size_t const size)
+        -> generator<std::span<cell<std::remove_cvref_t<decltype(*table.data())>> const>> {
+    using cell_type = cell<std::remove_cvref_t<decltype(*table.data())>>;
+
+    std::vector<cell_type> buffer;
+    buffer.reserve(size);
+
+    for (auto&& item: scan(table, region, std::move(predicate))) {
+        buffer.push_back(item);
+
+        if (buffer.size() == size) {
+            co_yield std::span<cell_type const> {buffer};
+            buffer.clear();
+        }
+    }
+
+    if (!buffer.empty())
+        co_yield std::span<cell_type const> {buffer};
+}
+
+}
+
+#endif
@@ -0,0 +1,190 @@
+#ifndef TABLE_HANDOFF_HPP
+#define TABLE_HANDOFF_HPP
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <cstddef>
+#include <utility>
+#include <algorithm>
+#include <type_traits>
+
+#include "../table.hpp"
+
+namespace ds {
+
+/// @brief An edit of a single table cell.
+
+template<typename value_type>
+struct edit {
+    enum class kind: std::uint8_t {
+        set,
+        erase
+    };
+
+    kind type {kind::set};
+    int row {0};
+    int column {0};
+    value_type value {};
+};
+
+/// @class Edit queue
+/// @brief A wait-free, single-producer single-consumer queue of table edits.
+/// @tparam capacity The maximum number of pending edits, which must be a power of two.
+/// @note One thread, such as a UI thread, enqueues edits with `set` and `erase`, and another thread,
+/// such as an audio thread, applies them to its table with `apply`. Neither operation blocks,
+/// allocates memory or throws, provided that `value_type` is nothrow move-assignable.
+
+template<typename value_type, std::size_t capacity>
+class edit_queue {
+    static_assert(capacity > 0 && (capacity & (capacity - 1)) == 0, "ds::edit_queue requires a power-of-two capacity");
+    static_assert(std::is_nothrow_move_assignable_v<value_type>, "ds::edit_queue requires a nothrow move-assignable type");
+
+public:
+    /// @brief Enqueue an edit that sets the value of the table cell at the given position.
+    /// @return Whether the edit was enqueued, which is `false` if the queue is full.
+    /// @note This should only be called by the producer thread.
+
+    inline bool set(int const row, int const column, value_type value) noexcept {
+        return push(edit<value_type>::kind::set, row, column, std::move(value));
+    }
+
+    /// @brief Enqueue an edit that erases the contents of the table cell at the given position.
+    /// @return Whether the edit was enqueued, which is `false` if the queue is full.
+    /// @note This should only be called by the producer thread.
+
+    inline bool erase(int const row, int const column) noexcept {
+        return push(edit<value_type>::kind::erase, row, column, value_type {});
+    }
+
+    /// @brief Apply up to the given number of pending edits to the given table, in the order they were enqueued.
+    /// @param table The table to be edited, which should have reserved capacity for real-time use.
+    /// @param limit The maximum number of edits to apply, which bounds the amount of time required.
+    /// @return The number of edits that were dequeued.
+    /// @note This should only be called by the consumer thread. Edits are applied with `try_set` and
+    /// `try_erase`, which must not throw, so the table's policies must not allocate. The set edits that the table
+    /// rejects because it is full, and the edits whose positions lie outside of the table, are counted by `rejected`.
+
+    template<typename grid>
+    std::size_t apply(grid& table, std::size_t const limit = capacity) noexcept {
+        static_assert(noexcept(table.try_set(0, 0, std::declval<value_type>())) && noexcept(table.try_erase(0, 0)),
+                      "ds::edit_queue::apply requires a table whose try_set and try_erase cannot throw");
+
+        auto const head = read_index.load(std::memory_order_relaxed);
+        auto const tail = write_index.load(std::memory_order_acquire);
+        auto const n = std::min<std::size_t>(tail - head, limit);
+
+        for (auto k = std::size_t {0}; k < n; ++k) {
+            auto& item = slots[(head + k) & (capacity - 1)];
+            auto const result = item.type == edit<value_type>::kind::set
+                              ? table.try_set(item.row, item.column, std::move(item.value))
+                              : table.try_erase(item.row, item.column);
+
+            rejections += result == status::full || result == status::out_of_range;
+        }
+
+        read_index.store(head + n, std::memory_order_release);
+        return n;
+    }
+
+    /// @brief Get the number of pending edits.
+    /// @note This is exact when called by either thread while the other is idle, and approximate otherwise.
+
+    [[nodiscard]]
+    inline std::size_t size() const noexcept {
+        return write_index.load(std::memory_order_acquire) - read_index.load(std::memory_order_acquire);
+    }
+
+    /// @brief Get the number of edits that were rejected, either because the table had no spare capacity for a set edit
+    /// or because the edit's position lay outside of the table.
+    /// @note This should only be called by the consumer thread.
+
+    [[nodiscard]]
+    inline std::size_t rejected() const noexcept {
+        return rejections;
+    }
+
+private:
+    inline bool push(typename edit<value_type>::kind const type, int const row, int const column, value_type&& value) noexcept {
+        auto const tail = write_index.load(std::memory_order_relaxed);
+        if (tail - read_index.load(std::memory_order_acquire) == capacity)
+            return false;
+
+        auto& item = slots[tail & (capacity - 1)];
+        item.type = type;
+        item.row = row;
+        item.column = column;
+        item.value = std::move(value);
+
+        write_index.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+private:
+    std::array<edit<value_type>, capacity> slots {};
+
+    alignas(64) std::atomic<std::size_t> write_index {0};
+    alignas(64) std::atomic<std::size_t> read_index {0};
+    std::size_t rejections {0};
+};
+
+/// @class Triple buffer
+/// @brief A wait-free handoff of whole values, such as table snapshots, from one writer thread to one reader thread.
+/// @note The writer fills `back()` and calls `publish()`; the reader calls `read()` to get the most recently
+/// published value, which remains valid and unmodified until the reader's next call to `read()`.
+/// Copying a table into a buffer that has already held a table of the same size reuses its memory.
+
+template<typename value_type>
+class triple_buffer {
+public:
+    /// @brief Get the buffer that the writer should fill before publishing.
+    /// @note This should only be called by the writer thread.
+
+    [[nodiscard]]
+    inline value_type& back() noexcept {
+        return buffers[back_index];
+    }
+
+    /// @brief Publish the contents of the back buffer to the reader.
+    /// @note This should only be called by the writer thread.
+
+    inline void publish() noexcept {
+        auto const previous = middle.exchange(static_cast<std::uint8_t>(back_index | fresh), std::memory_order_acq_rel);
+        back_index = previous & index_mask;
+    }
+
+    /// @brief Copy the given value into the back buffer and publish it.
+    /// @note This should only be called by the writer thread.
+
+    inline void publish(value_type const& value) {
+        back() = value;
+        publish();
+    }
+
+    /// @brief Get the most recently published value.
+    /// @note This should only be called by the reader thread.
+
+    [[nodiscard]]
+    inline value_type const& read() noexcept {
+        if (middle.load(std::memory_order_relaxed) & fresh) {
+            auto const previous = middle.exchange(front_index, std::memory_order_acq_rel);
+            front_index = previous & index_mask;
+        }
+
+        return buffers[front_index];
+    }
+
+private:
+    std::array<value_type, 3> buffers {};
+    std::uint8_t back_index {0};
+    std::uint8_t front_index {1};
+
+    alignas(64) std::atomic<std::uint8_t> middle {2};
+
+    std::uint8_t inline static constexpr fresh {4};
+    std::uint8_t inline static constexpr index_mask {3};
+};
+
+}
+
+#endif
@@ -0,0 +1,310 @@
+#ifndef TABLE_MULTI_TABLE_HPP
+#define TABLE_MULTI_TABLE_HPP
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <utility>
+#include <stdexcept>
+#include <type_traits>
+
+#include "../table.hpp"
+
+namespace ds {
+
+/// @class Multi-table
+/// @brief A grid topology where each cell holds any number of data items, such as a spatial hash of entities.
+/// @note The data items of every cell are stored in a single contiguous array. The items of each cell are
+/// linked into an intrusive doubly-linked list through parallel arrays of indices, so inserting, erasing and
+/// moving an item takes constant time. Each cell's bucket is stamped with a generation, so `rebuild` empties
+/// every cell in constant time for the per-frame "clear and reinsert all" pattern.
+/// @example `ds::multi_table<entity_id> grid(64, 64);`
+
+template<typename value_type>
+class multi_table {
+    struct bucket {
+        std::uint32_t generation {0};
+        int head {none};
+        int count {0};
+    };
+
+public:
+    /// @brief Construct an empty multi-table with the given dimensions.
+    /// @param number_of_rows The desired number of rows.
+    /// @param number_of_cols The desired number of columns.
+
+    multi_table(std::size_t const number_of_rows, std::size_t const number_of_cols):
+            height(number_of_rows),
+            width(number_of_cols),
+            buckets(number_of_rows * number_of_cols) {
+    }
+
+public:
+    /// @brief Get the dimensions of the multi-table.
+    /// @return The dimensions of the multi-table, (rows, cols).
+
+    [[nodiscard]]
+    inline std::pair<std::size_t, std::size_t> dimensions() const noexcept {
+        return {height, width};
+    }
+
+    /// @brief Get the number of data items stored in the multi-table.
+
+    [[nodiscard]]
+    inline std::size_t count() const noexcept {
+        return items.size();
+    }
+
+    /// @brief Get the number of data items in the cell at the given position.
+
+    [[nodiscard]]
+    inline int count(int const row, int const column) const {
+        auto const& b = buckets.at(get_table_index(row, column));
+        return b.generation == generation ? b.count : 0;
+    }
+
+    /// @brief Indicate whether the multi-table contains any data items or not.
+
+    [[nodiscard]]
+    inline bool empty() const noexcept {
+        return items.empty();
+    }
+
+public:
+    /// @brief Add a data item to the cell at the given position.
+    /// @param row The row index of the desired table cell.
+    /// @param column The column index of the desired table cell.
+    /// @param arguments The parameters that should be used to construct the new data item.
+    /// @return The index of the new data item, which remains valid until an item is erased.
+    /// @throws `std::out_of_range` if the position lies outside of the multi-table.
+
+    template<typename ...Arguments>
+    inline int emplace(int const row, int const column, Arguments&& ... arguments) {
+        if (!inside(row, column))
+            throw std::out_of_range("ds::multi_table: position out of range");
+
+        auto const i = static_cast<int>(items.size());
+        items.emplace_back(std::forward<Arguments>(arguments)...);
+        cells_indices.push_back(none);
+        links.push_back({none, none});
+        link(i, get_table_index(row, column));
+
+        return i;
+    }
+
+    /// @brief Add a copy of the given data item to the cell at the given position.
+    /// @see `ds::multi_table::emplace`
+
+    inline int insert(int const row, int const column, value_type element) {
+        return emplace(row, column, std::move(element));
+    }
+
+    /// @brief Erase the data item with the given index.
+    /// @param item The index of the data item to be erased.
+    /// @note The last data item takes the index of the erased item, so its index changes from `count() - 1` to `item`.
+
+    inline void erase(int const item) {
+        unlink(item);
+
+        auto const last = static_cast<int>(items.size()) - 1;
+        if (item != last) {
+            items[item] = std::move(items[last]);
+            cells_indices[item] = cells_indices[last];
+            links[item] = links[last];
+
+            auto const [previous, next] = links[item];
+            if (previous == none)
+                buckets[cells_indices[item]].head = item;
+            else
+                links[previous].second = item;
+
+            if (next != none)
+                links[next].first = item;
+        }
+
+        items.pop_back();
+        cells_indices.pop_back();
+        links.pop_back();
+    }
+
+    /// @brief Move the data item with the given index to the cell at the given position.
+    /// @throws `std::out_of_range` if the position lies outside of the multi-table.
+
+    inline void move(int const item, int const row, int const column) {
+        if (!inside(row, column))
+            throw std::out_of_range("ds::multi_table: position out of range");
+
+        unlink(item);
+        link(item, get_table_index(row, column));
+    }
+
+    /// @brief Erase every data item in constant time, ready for the items of the next frame to be inserted.
+    /// @note The capacity of the array of data items is retained. If the data items are not trivially
+    /// destructible, the amount of time required is linear in their number.
+
+    inline void rebuild() {
+        items.clear();
+        cells_indices.clear();
+        links.clear();
+
+        if (++generation == 0) {
+            for (auto& b: buckets) {
+                b = bucket {};
+            }
+
+            generation = 1;
+        }
+    }
+
+    /// @brief Reserve capacity for the given number of data items.
+
+    inline void reserve(std::size_t const capacity) {
+        items.reserve(capacity);
+        cells_indices.reserve(capacity);
+        links.reserve(capacity);
+    }
+
+public:
+    /// @brief Invoke the given task with each data item in the cell at the given position.
+    /// @param task A function with the signature `void(value_type& value)` or `void(int item, value_type& value)`.
+    /// @note The items are visited from the most recently inserted. The task must not insert or erase items.
+
+    template<typename task_function>
+    inline void for_each_in_cell(int const row, int const column, task_function&& task) {
+        visit(*this, row, column, task);
+    }
+
+    /// @brief Invoke the given task with each data item in the cell at the given position.
+    /// @see `ds::multi_table::for_each_in_cell`
+
+    template<typename task_function>
+    inline void for_each_in_cell(int const row, int const column, task_function&& task) const {
+        visit(*this, row, column, task);
+    }
+
+    /// @brief Get the (row, column) position of the data item with the given index.
+
+    [[nodiscard]]
+    inline std::pair<int, int> position(int const item) const {
+        auto const t = cells_indices.at(item);
+        return {t / static_cast<int>(width), t % static_cast<int>(width)};
+    }
+
+    /// @brief Get the data item with the given index.
+
+    inline value_type& operator[](int const item) {
+        return items[item];
+    }
+
+    /// @brief Get the data item with the given index.
+
+    inline value_type const& operator[](int const item) const {
+        return items[item];
+    }
+
+    /// @brief Get a pointer to the underlying array of data items.
+
+    inline auto data() const {
+        return items.data();
+    }
+
+    /// @brief Get a read-only 'begin' iterator for the underlying array of data items.
+
+    inline auto begin() const {
+        return items.begin();
+    }
+
+    /// @brief Get a read-only 'end' iterator for the underlying array of data items.
+
+    inline auto end() const {
+        return items.end();
+    }
+
+private:
+    template<typename self_type, typename task_function>
+    inline static void visit(self_type& self, int const row, int const column, task_function& task) {
+        auto const& b = self.buckets.at(self.get_table_index(row, column));
+        if (b.generation != self.generation)
+            return;
+
+        for (auto i = b.head; i != none; i = self.links[i].second) {
+            if constexpr (std::is_invocable_v<task_function&, int, decltype(self.items[i])>)
+                task(i, self.items[i]);
+            else
+                task(self.items[i]);
+        }
+    }
+
+    /// @brief Link the given data item at the front of the list of the cell with the given 1d table index.
+
+    inline void link(int const item, int const table_index) {
+        auto& b = buckets[table_index];
+        if (b.generation != generation)
+            b = {generation, none, 0};
+
+        links[item] = {none, b.head};
+        if (b.head != none)
+            links[b.head].first = item;
+
+        b.head = item;
+        b.count += 1;
+        cells_indices[item] = table_index;
+    }
+
+    /// @brief Unlink the given data item from the list of its cell.
+
+    inline void unlink(int const item) {
+        auto& b = buckets[cells_indices.at(item)];
+        auto const [previous, next] = links[item];
+
+        if (previous == none)
+            b.head = next;
+        else
+            links[previous].second = next;
+
+        if (next != none)
+            links[next].first = previous;
+
+        b.count -= 1;
+    }
+
+    [[nodiscard]]
+    inline bool inside(int const row, int const column) const noexcept {
+        return row >= 0 && column >= 0 && row < static_cast<int>(height) && column < static_cast<int>(width);
+    }
+
+    [[nodiscard]]
+    inline int get_table_index(int const row, int const column) const noexcept {
+        return row * static_cast<int>(width) + column;
+    }
+
+public:
+    /// @brief The value reserved to represent the absence of an item.
+
+    auto inline static constexpr none {-INT_MAX};
+
+private:
+    std::size_t height;
+    std::size_t width;
+
+    /// @brief The data items of every cell.
+
+    std::vector<value_type> items;
+
+    /// @brief The table indices of the cells that hold the data items, which is parallel to `items`.
+
+    std::vector<int> cells_indices;
+
+    /// @brief The (previous, next) items in the list of each data item's cell, which is parallel to `items`.
+
+    std::vector<std::pair<int, int>> links;
+
+    /// @brief The head and number of items of the list of each cell, valid if its generation is current.
+
+    std::vector<bucket> buckets;
+    std::uint32_t generation {1};
+};
+
+}
+
+#endif
@@ -0,0 +1,358 @@
+#ifndef TABLE_PAGED_TABLE_HPP
+#define TABLE_PAGED_TABLE_HPP
+
+#if !__has_include(<unistd.h>) || !__has_include(<sys/uio.h>)
+#error "table/paged_table.hpp requires POSIX file I/O."
+#endif
+
+#include <string>
+#include <vector>
+#include <cerrno>
+#include <cstdint>
+#include <cstddef>
+#include <climits>
+#include <utility>
+#include <algorithm>
+#include <stdexcept>
+#include <type_traits>
+#include <system_error>
+#include <unordered_map>
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/uio.h>
+
+#include "../table.hpp"
+
+namespace ds {
+
+/// @class Paged table
+/// @brief An out-of-core table whose cells are divided into square tiles, of which only a bounded number are
+/// resident in memory. The other tiles are kept in a backing file and are read back when they're accessed.
+/// @tparam value_type A trivially copyable type, which is written to the backing file byte for byte.
+/// @note Each tile is stored as a fixed-size record of an occupancy bitmap and a dense array of values, at an
+/// offset given by its index, so the backing file is sparse and tiles that were never written read back empty.
+/// Resident tiles are evicted with the CLOCK algorithm, and dirty tiles are written back when they're evicted
+/// or when `flush` is called, which coalesces adjacent tiles into single `pwritev` calls.
+/// Pointers returned by `get` and `set` are invalidated by the next access to a different tile.
+
+template<typename value_type>
+class paged_table {
+    static_assert(std::is_trivially_copyable_v<value_type>, "ds::paged_table requires a trivially copyable type");
+    static_assert(std::is_default_constructible_v<value_type>, "ds::paged_table requires a default-constructible type");
+
+public:
+    /// @brief Construct an empty paged table backed by the file at the given path, which is created or truncated.
+    /// @param path The path of the backing file.
+    /// @param number_of_rows The desired number of rows.
+    /// @param number_of_cols The desired number of columns.
+    /// @param budget The maximum number of bytes of tiles that should be resident in memory. At least one tile is resident.
+    /// @param tile_size The number of rows and columns of each tile.
+    /// @throws `std::invalid_argument` if the tile size is zero, or `std::system_error` if the backing file cannot be opened.
+
+    paged_table(std::string const& path, std::size_t const number_of_rows, std::size_t const number_of_cols,
+                std::size_t const budget, std::size_t const tile_size = 64):
+            height(number_of_rows),
+            width(number_of_cols),
+            tile(validate_tile_size(tile_size)),
+            tiles_per_row((number_of_cols + tile - 1) / tile),
+            words_per_tile((tile * tile + 63) / 64),
+            record_size(words_per_tile * sizeof(std::uint64_t) + tile * tile * sizeof(value_type)) {
+        descriptor = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+        if (descriptor < 0)
+            throw std::system_error(errno, std::generic_category(), "ds::paged_table: failed to open " + path);
+
+        auto const frames = std::max<std::size_t>(1, budget / record_size);
+        bits.resize(frames * words_per_tile);
+        values.resize(frames * tile * tile);
+        frame_tiles.assign(frames, none);
+        dirty.assign(frames, 0);
+        referenced.assign(frames, 0);
+        resident.reserve(frames);
+    }
+
+    paged_table(paged_table const&) = delete;
+    paged_table& operator=(paged_table const&) = delete;
+
+    ~paged_table() {
+        ::close(descriptor);
+    }
+
+public:
+    /// @brief Get the dimensions of the table.
+    /// @return The dimensions of the table, (rows, cols).
+
+    [[nodiscard]]
+    inline std::pair<std::size_t, std::size_t> dimensions() const noexcept {
+        return {height, width};
+    }
+
+    /// @brief Get the number of data items stored in the table, including those in tiles that aren't resident.
+
+    [[nodiscard]]
+    inline std::size_t count() const noexcept {
+        return items;
+    }
+
+    /// @brief Get a pointer to the contents of the table cell at the given position.
+    /// @return A pointer to the contents of the cell, which is valid until a different tile is accessed, or `nullptr` if the cell is empty.
+    /// @throws `std::out_of_range` if the position lies outside of the table, or `std::system_error` if a tile cannot be read or written.
+
+    inline value_type* get(int const row, int const column) {
+        auto const [frame, k] = locate(row, column);
+        return occupied(frame, k) ? &values[frame * tile * tile + k] : nullptr;
+    }
+
+    /// @brief Indicate whether the table cell at the given position contains an element or not.
+    /// @see `ds::paged_table::get`
+
+    [[nodiscard]]
+    inline bool contains(int const row, int const column) {
+        auto const [frame, k] = locate(row, column);
+        return occupied(frame, k);
+    }
+
+    /// @brief Set the value of the table cell at the given position.
+    /// @return A reference to the contents of the cell, which is valid until a different tile is accessed.
+    /// @see `ds::paged_table::get`
+
+    inline value_type& set(int const row, int const column, value_type const& element) {
+        auto const [frame, k] = locate(row, column);
+        auto& word = bits[frame * words_per_tile + k / 64];
+        auto const mask = std::uint64_t {1} << (k % 64);
+
+        items += (word & mask) == 0;
+        word |= mask;
+        dirty[frame] = 1;
+
+        return values[frame * tile * tile + k] = element;
+    }
+
+    /// @brief Erase the contents of the table cell at the given position, if any.
+    /// @see `ds::paged_table::get`
+
+    inline void erase(int const row, int const column) {
+        auto const [frame, k] = locate(row, column);
+        auto& word = bits[frame * words_per_tile + k / 64];
+        auto const mask = std::uint64_t {1} << (k % 64);
+
+        if (word & mask) {
+            word &= ~mask;
+            dirty[frame] = 1;
+            --items;
+        }
+    }
+
+    /// @brief Write every dirty resident tile to the backing file.
+    /// @note Tiles are written in file order, and runs of adjacent tiles are written with a single `pwritev`.
+    /// @throws `std::system_error` if a tile cannot be written.
+
+    void flush() {
+        std::vector<std::size_t> frames;
+        for (auto frame = std::size_t {0}; frame < frame_tiles.size(); ++frame) {
+            if (dirty[frame])
+                frames.push_back(frame);
+        }
+
+        std::sort(frames.begin(), frames.end(), [&](auto const a, auto const b) {
+            return frame_tiles[a] < frame_tiles[b];
+        });
+
+        auto const limit = static_cast<std::size_t>(IOV_MAX / 2);
+        for (auto first = std::size_t {0}; first < frames.size();) {
+            auto last = first + 1;
+            while (last < frames.size() && last - first < limit && frame_tiles[frames[last]] == frame_tiles[frames[last - 1]] + 1) {
+                ++last;
+            }
+
+            std::vector<iovec> buffers;
+            for (auto k = first; k < last; ++k) {
+                auto const segments = record(frames[k]);
+                buffers.insert(buffers.end(), segments.begin(), segments.end());
+                dirty[frames[k]] = 0;
+            }
+
+            transfer(::pwritev, buffers, frame_tiles[frames[first]], (last - first) * record_size, "write");
+            first = last;
+        }
+    }
+
+    /// @brief Get the number of tiles that have been read from the backing file.
+
+    [[nodiscard]]
+    inline std::size_t faults() const noexcept {
+        return fault_count;
+    }
+
+    /// @brief Get the number of resident tiles that have been evicted.
+
+    [[nodiscard]]
+    inline std::size_t evictions() const noexcept {
+        return eviction_count;
+    }
+
+private:
+    /// @brief Check the given tile size before the constructor divides by it.
+    /// @throws `std::invalid_argument` if the tile size is zero.
+
+    inline static std::size_t validate_tile_size(std::size_t const tile_size) {
+        if (tile_size == 0)
+            throw std::invalid_argument("ds::paged_table: the tile size must be positive");
+
+        return tile_size;
+    }
+
+    /// @brief Get the frame of the tile that holds the given position, faulting it in if necessary, and the position's index within the tile.
+
+    inline std::pair<std::size_t, std::size_t> locate(int const row, int const column) {
+        if (row < 0 || column < 0 || row >= static_cast<int>(height) || column >= static_cast<int>(width))
+            throw std::out_of_range("ds::paged_table: position out of range");
+
+        auto const y = static_cast<std::size_t>(row);
+        auto const x = static_cast<std::size_t>(column);
+        auto const t = static_cast<std::int64_t>((y / tile) * tiles_per_row + x / tile);
+
+        if (t != last_tile) {
+            auto const entry = resident.find(t);
+            last_frame = entry != resident.end() ? entry->second : fault(t);
+            last_tile = t;
+        }
+
+        referenced[last_frame] = 1;
+        return {last_frame, (y % tile) * tile + x % tile};
+    }
+
+    [[nodiscard]]
+    inline bool occupied(std::size_t const frame, std::size_t const k) const noexcept {
+        return (bits[frame * words_per_tile + k / 64] >> (k % 64)) & 1;
+    }
+
+    /// @brief Read the given tile into a frame, evicting the frame's tile with the CLOCK algorithm if every frame is in use.
+
+    std::size_t fault(std::int64_t const t) {
+        auto frame = used;
+        if (used < frame_tiles.size()) {
+            ++used;
+        } else {
+            while (referenced[hand]) {
+                referenced[hand] = 0;
+                hand = (hand + 1) % frame_tiles.size();
+            }
+
+            frame = hand;
+            hand = (hand + 1) % frame_tiles.size();
+            evict(frame);
+        }
+
+        auto buffers = record(frame);
+        auto const read = transfer(::preadv, buffers, t, record_size, "read");
+        if (read < record_size)
+            std::fill(bits.begin() + frame * words_per_tile, bits.begin() + (frame + 1) * words_per_tile, 0);
+
+        frame_tiles[frame] = t;
+        resident[t] = frame;
+        ++fault_count;
+
+        return frame;
+    }
+
+    void evict(std::size_t const frame) {
+        if (dirty[frame]) {
+            auto buffers = record(frame);
+            transfer(::pwritev, buffers, frame_tiles[frame], record_size, "write");
+            dirty[frame] = 0;
+        }
+
+        resident.erase(frame_tiles[frame]);
+        if (last_tile == frame_tiles[frame])
+            last_tile = none;
+
+        ++eviction_count;
+    }
+
+    /// @brief Get the I/O segments of the record of the given frame: its occupancy bitmap and its values.
+
+    inline std::vector<iovec> record(std::size_t const frame) {
+        return {
+            {bits.data() + frame * words_per_tile, words_per_tile * sizeof(std::uint64_t)},
+            {values.data() + frame * tile * tile, tile * tile * sizeof(value_type)}
+        };
+    }
+
+    /// @brief Transfer the given segments to or from the record of the given tile, retrying partial transfers.
+    /// @return The number of bytes transferred, which is less than `size` only if a read reached the end of the file.
+
+    template<typename io_function>
+    std::size_t transfer(io_function&& io, std::vector<iovec>& buffers, std::int64_t const t, std::size_t const size, char const* action) {
+        auto offset = static_cast<off_t>(t) * static_cast<off_t>(record_size);
+        auto done = std::size_t {0};
+        auto segment = std::size_t {0};
+
+        while (done < size) {
+            auto const n = io(descriptor, buffers.data() + segment, static_cast<int>(buffers.size() - segment), offset);
+            if (n < 0 && errno == EINTR)
+                continue;
+
+            if (n < 0)
+                throw std::system_error(errno, std::generic_category(), std::string("ds::paged_table: failed to ") + action + " a tile");
+
+            if (n == 0)
+                break;
+
+            done += static_cast<std::size_t>(n);
+            offset += n;
+
+            for (auto remaining = static_cast<std::size_t>(n); remaining > 0;) {
+                auto& buffer = buffers[segment];
+                auto const step = std::min(remaining, buffer.iov_len);
+                buffer.iov_base = static_cast<char*>(buffer.iov_base) + step;
+                buffer.iov_len -= step;
+                remaining -= step;
+                if (buffer.iov_len == 0)
+                    ++segment;
+            }
+        }
+
+        return done;
+    }
+
+public:
+    /// @brief The value reserved to represent the absence of a tile.
+
+    auto inline static constexpr none {std::int64_t {-1}};
+
+private:
+    std::size_t height;
+    std::size_t width;
+    std::size_t tile;
+    std::size_t tiles_per_row;
+    std::size_t words_per_tile;
+    std::size_t record_size;
+
+    int descriptor {-1};
+
+    /// @brief The occupancy bitmaps and values of the resident tiles, one record per frame.
+
+    std::vector<std::uint64_t> bits;
+    std::vector<value_type> values;
+
+    /// @brief The tile held by each frame, and whether it has been modified or recently accessed.
+
+    std::vector<std::int64_t> frame_tiles;
+    std::vector<std::uint8_t> dirty;
+    std::vector<std::uint8_t> referenced;
+    std::unordered_map<std::int64_t, std::size_t> resident;
+
+    std::size_t used {0};
+    std::size_t hand {0};
+    std::int64_t last_tile {none};
+    std::size_t last_frame {0};
+
+    std::size_t items {0};
+    std::size_t fault_count {0};
+    std::size_t eviction_count {0};
+};
+
+}
+
+#endif
@@ -0,0 +1,372 @@
+#ifndef TABLE_PALETTE_TABLE_HPP
+#define TABLE_PALETTE_TABLE_HPP
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <utility>
+#include <optional>
+#include <stdexcept>
+#include <functional>
+#include <unordered_map>
+
+#include "../table.hpp"
+
+namespace ds {
+
+/// @class Palette table
+/// @brief A table of low-cardinality data, such as voxels or terrain, where each cell holds an index into
+/// a deduplicated palette of distinct values rather than a copy of its value.
+/// @note The palette indices are bit-packed into 64-bit words with a width of 1, 2, 4, 8, 16 or 32 bits, which
+/// is the least that can index the palette, and which grows as the palette grows. Palette index 0 represents an
+/// empty cell. Entries whose values no longer appear in the table are reused, and `compact` narrows the width.
+/// Filtering cells by value compares whole words of indices at once.
+/// @example `ds::palette_table<block> chunk(4096, 4096);`
+
+template<typename value_type, typename hash = std::hash<value_type>>
+class palette_table {
+public:
+    /// @brief Construct an empty palette table with the given dimensions.
+    /// @param number_of_rows The desired number of rows.
+    /// @param number_of_cols The desired number of columns.
+
+    palette_table(std::size_t const number_of_rows, std::size_t const number_of_cols):
+            height(number_of_rows),
+            width(number_of_cols),
+            words((number_of_rows * number_of_cols + 63) / 64) {
+    }
+
+public:
+    /// @brief Get the dimensions of the table.
+    /// @return The dimensions of the table, (rows, cols).
+
+    [[nodiscard]]
+    inline std::pair<std::size_t, std::size_t> dimensions() const noexcept {
+        return {height, width};
+    }
+
+    /// @brief Get the number of occupied cells.
+
+    [[nodiscard]]
+    inline std::size_t count() const noexcept {
+        return items;
+    }
+
+    /// @brief Get the number of cells whose value is equal to the given value.
+    /// @note The amount of time required is linear in the number of words of indices, not in the number of cells.
+    /// Matches are summed per lane across as many words as a lane can count before the lanes are added together.
+
+    [[nodiscard]]
+    std::size_t count(value_type const& value) const {
+        auto const b = bits_per_cell;
+        auto const limit = b >= 16 ? std::size_t {0xffff} : (std::size_t {1} << b) - 1;
+
+        auto n = std::size_t {0};
+        auto lanes = std::uint64_t {0};
+        auto pending = std::size_t {0};
+
+        scan(value, [&](std::size_t, std::uint64_t const matches) {
+            lanes += matches;
+            if (++pending == limit) {
+                n += sum_lanes(lanes, b);
+                lanes = 0;
+                pending = 0;
+            }
+        });
+
+        return n + sum_lanes(lanes, b);
+    }
+
+    /// @brief Get the number of bits of each cell's palette index.
+
+    [[nodiscard]]
+    inline int bits() const noexcept {
+        return bits_per_cell;
+    }
+
+    /// @brief Get the palette, where the value of palette index `p` is `palette()[p - 1]`.
+    /// @note Entries whose values no longer appear in the table are retained until they're reused or `compact` is called.
+
+    [[nodiscard]]
+    inline std::vector<value_type> const& palette() const noexcept {
+        return entries;
+    }
+
+    /// @brief Get the palette index of the given value, if it appears in the table.
+
+    [[nodiscard]]
+    inline std::optional<std::uint32_t> find(value_type const& value) const {
+        auto const entry = indices.find(value);
+        return entry != indices.end() ? std::optional<std::uint32_t> {entry->second} : std::nullopt;
+    }
+
+    /// @brief Get the palette index of the table cell at the given position, which is 0 if the cell is empty.
+    /// @throws `std::out_of_range` if the position lies outside of the table.
+
+    [[nodiscard]]
+    inline std::uint32_t index(int const row, int const column) const {
+        return read(get_table_index(row, column));
+    }
+
+    /// @brief Get a pointer to the value of the table cell at the given position.
+    /// @return A pointer to the cell's entry in the palette, or `nullptr` if the cell is empty.
+    /// @throws `std::out_of_range` if the position lies outside of the table.
+
+    inline value_type const* get(int const row, int const column) const {
+        auto const p = index(row, column);
+        return p == 0 ? nullptr : &entries[p - 1];
+    }
+
+    /// @brief Indicate whether the table cell at the given position contains an element or not.
+    /// @throws `std::out_of_range` if the position lies outside of the table.
+
+    [[nodiscard]]
+    inline bool contains(int const row, int const column) const {
+        return index(row, column) != 0;
+    }
+
+public:
+    /// @brief Set the value of the table cell at the given position.
+    /// @note If the value is new and the palette outgrows the current width, every index is repacked at twice the width.
+    /// @throws `std::out_of_range` if the position lies outside of the table.
+
+    void set(int const row, int const column, value_type const& element) {
+        auto const k = get_table_index(row, column);
+        auto const p = intern(element);
+        auto const previous = read(k);
+
+        if (previous == p)
+            return;
+
+        if (previous == 0)
+            ++items;
+        else
+            release(previous);
+
+        write(k, p);
+        ++references[p - 1];
+    }
+
+    /// @brief Erase the contents of the table cell at the given position, if any.
+    /// @throws `std::out_of_range` if the position lies outside of the table.
+
+    void erase(int const row, int const column) {
+        auto const k = get_table_index(row, column);
+        auto const previous = read(k);
+
+        if (previous != 0) {
+            release(previous);
+            write(k, 0);
+            --items;
+        }
+    }
+
+    /// @brief Erase every cell.
+
+    void reset() {
+        std::fill(words.begin(), words.end(), 0);
+        entries.clear();
+        references.clear();
+        unused.clear();
+        indices.clear();
+        bits_per_cell = 1;
+        items = 0;
+    }
+
+    /// @brief Drop the palette entries that no longer appear in the table and repack the indices at the least width.
+    /// @note The amount of time required is linear in the number of cells. Palette indices may change.
+
+    void compact() {
+        std::vector<std::uint32_t> remap(entries.size() + 1, 0);
+        std::vector<value_type> kept;
+        std::vector<std::size_t> counts;
+
+        indices.clear();
+        for (auto p = std::size_t {0}; p < entries.size(); ++p) {
+            if (references[p] == 0)
+                continue;
+
+            kept.push_back(std::move(entries[p]));
+            counts.push_back(references[p]);
+            remap[p + 1] = static_cast<std::uint32_t>(kept.size());
+            indices.emplace(kept.back(), remap[p + 1]);
+        }
+
+        entries = std::move(kept);
+        references = std::move(counts);
+        unused.clear();
+        repack(width_for(entries.size()), remap.data());
+    }
+
+    /// @brief Invoke the given task with the position of each cell whose value is equal to the given value, in row-major order.
+    /// @param task A function with the signature `void(int row, int column)`.
+
+    template<typename task_function>
+    void for_each_equal(value_type const& value, task_function&& task) const {
+        scan(value, [&](std::size_t const word, std::uint64_t const matches) {
+            for_each_set_bit(&matches, 1, [&](int const bit) {
+                auto const k = static_cast<int>(word * static_cast<std::size_t>(64 / bits_per_cell) + static_cast<std::size_t>(bit / bits_per_cell));
+                auto const w = static_cast<int>(width);
+                task(k / w, k % w);
+            });
+        });
+    }
+
+private:
+    /// @brief Invoke the given task with each word of indices and a mask of the lowest bit of each index in the word
+    /// that is equal to the given value's. The task is invoked for every word, because whether a word matches is unpredictable.
+
+    template<typename task_function>
+    void scan(value_type const& value, task_function&& task) const {
+        auto const p = find(value);
+        if (!p)
+            return;
+
+        auto const b = bits_per_cell;
+        auto const lanes = lane_mask(b);
+        auto const pattern = lanes * *p;
+        auto const low = lanes * ((std::uint64_t {1} << (b - 1)) - 1);
+        auto const high = lanes << (b - 1);
+
+        for (auto w = std::size_t {0}; w < words.size(); ++w) {
+            auto const x = words[w] ^ pattern;
+            task(w, (~((((x & low) + low) | x) & high) & high) >> (b - 1));
+        }
+    }
+
+    /// @brief Get the palette index of the given value, adding it to the palette if it's new.
+
+    std::uint32_t intern(value_type const& value) {
+        if (auto const entry = indices.find(value); entry != indices.end())
+            return entry->second;
+
+        auto p = std::uint32_t {0};
+        if (!unused.empty()) {
+            p = unused.back();
+            unused.pop_back();
+            entries[p - 1] = value;
+        } else {
+            if (entries.size() == 0xffffffffu)
+                throw std::length_error("ds::palette_table: the palette is full");
+
+            entries.push_back(value);
+            references.push_back(0);
+            p = static_cast<std::uint32_t>(entries.size());
+
+            if (auto const b = width_for(entries.size()); b > bits_per_cell)
+                repack(b, nullptr);
+        }
+
+        indices.emplace(value, p);
+        return p;
+    }
+
+    void release(std::uint32_t const p) {
+        if (--references[p - 1] == 0) {
+            indices.erase(entries[p - 1]);
+            unused.push_back(p);
+        }
+    }
+
+    /// @brief Rewrite every index at the given width, mapping each through `remap` if it's given.
+
+    void repack(int const b, std::uint32_t const* remap) {
+        auto const cells = height * width;
+        std::vector<std::uint64_t> packed((cells * static_cast<std::size_t>(b) + 63) / 64, 0);
+
+        for (auto k = std::size_t {0}; k < cells; ++k) {
+            auto p = static_cast<std::uint64_t>(read(k));
+            if (remap)
+                p = remap[p];
+
+            packed[k * b / 64] |= p << (k * b % 64);
+        }
+
+        words = std::move(packed);
+        bits_per_cell = b;
+    }
+
+    [[nodiscard]]
+    inline std::uint32_t read(std::size_t const k) const noexcept {
+        auto const b = static_cast<std::size_t>(bits_per_cell);
+        auto const mask = (std::uint64_t {1} << b) - 1;
+        return static_cast<std::uint32_t>((words[k * b / 64] >> (k * b % 64)) & mask);
+    }
+
+    inline void write(std::size_t const k, std::uint32_t const p) noexcept {
+        auto const b = static_cast<std::size_t>(bits_per_cell);
+        auto const mask = (std::uint64_t {1} << b) - 1;
+        auto& word = words[k * b / 64];
+        word = (word & ~(mask << (k * b % 64))) | (static_cast<std::uint64_t>(p) << (k * b % 64));
+    }
+
+    /// @brief Get the least width of 1, 2, 4, 8, 16 or 32 bits that can index a palette of the given size and the empty index.
+
+    [[nodiscard]]
+    inline static int width_for(std::size_t const size) noexcept {
+        auto b = 1;
+        while (b < 32 && (std::uint64_t {1} << b) <= size) {
+            b *= 2;
+        }
+
+        return b;
+    }
+
+    /// @brief Add together the lanes of the given width of the given word.
+
+    [[nodiscard]]
+    inline static std::size_t sum_lanes(std::uint64_t word, int const b) noexcept {
+        std::uint64_t static constexpr masks[] {
+            0x5555555555555555, 0x3333333333333333, 0x0f0f0f0f0f0f0f0f,
+            0x00ff00ff00ff00ff, 0x0000ffff0000ffff, 0x00000000ffffffff
+        };
+
+        for (auto w = b, k = count_trailing_zeros(static_cast<std::uint64_t>(b)); w < 64; w *= 2, ++k) {
+            word = (word & masks[k]) + ((word >> w) & masks[k]);
+        }
+
+        return static_cast<std::size_t>(word);
+    }
+
+    /// @brief Get a word with the lowest bit of each lane of the given width set.
+
+    [[nodiscard]]
+    inline static std::uint64_t lane_mask(int const b) noexcept {
+        auto mask = std::uint64_t {0};
+        for (auto lane = 0; lane < 64; lane += b) {
+            mask |= std::uint64_t {1} << lane;
+        }
+
+        return mask;
+    }
+
+    [[nodiscard]]
+    inline std::size_t get_table_index(int const row, int const column) const {
+        if (row < 0 || column < 0 || row >= static_cast<int>(height) || column >= static_cast<int>(width))
+            throw std::out_of_range("ds::palette_table: position out of range");
+
+        return static_cast<std::size_t>(row) * width + static_cast<std::size_t>(column);
+    }
+
+private:
+    std::size_t height;
+    std::size_t width;
+    std::size_t items {0};
+
+    /// @brief The palette index of each cell, packed into words at `bits_per_cell` bits per index.
+
+    std::vector<std::uint64_t> words;
+    int bits_per_cell {1};
+
+    /// @brief The distinct values of the table, the number of cells that refer to each, and the palette
+    /// indices of the entries that no longer appear in the table.
+
+    std::vector<value_type> entries;
+    std::vector<std::size_t> references;
+    std::vector<std::uint32_t> unused;
+    std::unordered_map<value_type, std::uint32_t, hash> indices;
+};
+
+}
+
+#endif
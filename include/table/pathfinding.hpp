@@ -0,0 +1,363 @@
+#ifndef TABLE_PATHFINDING_HPP
+#define TABLE_PATHFINDING_HPP
+
+#include <cmath>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <utility>
+#include <algorithm>
+#include <functional>
+
+#include "../table.hpp"
+
+namespace ds {
+
+/// @class Pathfinder
+/// @brief Shortest-path search over the cells of a table with 8-connectivity.
+/// @note Diagonal steps cost √2 and may not cut the corner of an impassable cell.
+/// @note The open and closed sets are retained between queries and invalidated by a
+/// generation counter, so a pathfinder that is reused for tables of the same size does
+/// not allocate once its path and heap buffers have grown.
+
+class pathfinder {
+public:
+    using position = std::pair<int, int>;
+
+public:
+    /// @brief Find a shortest path between two empty cells, treating occupied cells as obstacles.
+    /// This uses Jump Point Search, which expands only the cells at which the path may change direction.
+    /// @param table The table whose occupied cells are obstacles.
+    /// @param from The (row, column) position of the first cell of the path.
+    /// @param to The (row, column) position of the last cell of the path.
+    /// @param path The container into which the cells of the path, from `from` to `to`, should be written.
+    /// @return Whether a path exists.
+
+    template<typename grid>
+    bool find_path(grid const& table, position const from, position const to, std::vector<position>& path) {
+        path.clear();
+        prepare(table.dimensions(), to);
+
+        lookup = table.lookup();
+        layout = layout_of(table);
+        empty = grid::none;
+
+        if (!inside(from.first, from.second) || !walkable(to.first, to.second))
+            return false;
+
+        auto const start = index_of(from.first, from.second);
+        open(start, start, 0.0f, heuristic(from.first, from.second));
+
+        while (!heap.empty()) {
+            auto const node = next();
+            if (node == none)
+                break;
+
+            if (node == goal)
+                return trace(path, true);
+
+            auto const y = node / cols;
+            auto const x = node % cols;
+            auto const p = parent[node];
+            auto const dy = p == node ? 0 : sign(y - p / cols);
+            auto const dx = p == node ? 0 : sign(x - p % cols);
+
+            successors.clear();
+            prune(y, x, dy, dx);
+
+            for (auto const& [sy, sx]: successors) {
+                auto const jump_point = jump(y + sy, x + sx, sy, sx);
+                if (jump_point == none)
+                    continue;
+
+                auto const jy = jump_point / cols;
+                auto const jx = jump_point % cols;
+                auto const g = cost[node] + octile(std::abs(jy - y), std::abs(jx - x));
+                open(jump_point, node, g, g + heuristic(jy, jx));
+            }
+        }
+
+        return false;
+    }
+
+    /// @brief Find a shortest path between two cells using a cost per cell.
+    /// @param table The table whose cells should be weighted.
+    /// @param from The (row, column) position of the first cell of the path.
+    /// @param to The (row, column) position of the last cell of the path.
+    /// @param path The container into which the cells of the path, from `from` to `to`, should be written.
+    /// @param weight A function that maps a pointer to the contents of a cell, or `nullptr` if the cell is empty,
+    /// to the cost of entering it. The cost should be at least 1 for the search to be optimal, or negative if the
+    /// cell is impassable.
+    /// @return Whether a path exists.
+
+    template<typename grid, typename weight_function>
+    bool find_path(grid const& table, position const from, position const to, std::vector<position>& path,
+                   weight_function&& weight) {
+        path.clear();
+        prepare(table.dimensions(), to);
+
+        auto const passable = [&](int const y, int const x) {
+            return inside(y, x) && weight(table.get(y, x)) >= 0;
+        };
+
+        if (!inside(from.first, from.second) || !passable(to.first, to.second))
+            return false;
+
+        auto const start = index_of(from.first, from.second);
+        open(start, start, 0.0f, heuristic(from.first, from.second));
+
+        while (!heap.empty()) {
+            auto const node = next();
+            if (node == none)
+                break;
+
+            if (node == goal)
+                return trace(path, false);
+
+            auto const y = node / cols;
+            auto const x = node % cols;
+
+            for (auto sy = -1; sy <= 1; ++sy) {
+                for (auto sx = -1; sx <= 1; ++sx) {
+                    if ((sy == 0 && sx == 0) || !passable(y + sy, x + sx))
+                        continue;
+
+                    if (sy != 0 && sx != 0 && !(passable(y + sy, x) && passable(y, x + sx)))
+                        continue;
+
+                    auto const step = static_cast<float>(weight(table.get(y + sy, x + sx)));
+                    auto const g = cost[node] + octile(sy * sy, sx * sx) * step;
+                    open(index_of(y + sy, x + sx), node, g, g + heuristic(y + sy, x + sx));
+                }
+            }
+        }
+
+        return false;
+    }
+
+    /// @brief Get the cost of the path that was most recently found.
+
+    [[nodiscard]]
+    inline float distance() const noexcept {
+        return length;
+    }
+
+private:
+    /// @brief Grow the pooled buffers to the given dimensions and begin a new generation.
+
+    void prepare(std::pair<std::size_t, std::size_t> const dimensions, position const to) {
+        rows = static_cast<int>(dimensions.first);
+        cols = static_cast<int>(dimensions.second);
+        goal = index_of(to.first, to.second);
+        length = 0.0f;
+        heap.clear();
+
+        auto const size = dimensions.first * dimensions.second;
+        if (cost.size() < size) {
+            cost.resize(size);
+            parent.resize(size);
+            state.resize(size, 0);
+        }
+
+        if (generation >= UINT32_MAX - 2) {
+            std::fill(state.begin(), state.end(), 0);
+            generation = 0;
+        }
+
+        generation = generation + 2;
+    }
+
+    /// @brief Record a tentative cost for the given node and push it onto the open set if it improves.
+
+    void open(int const node, int const from, float const g, float const f) {
+        if (state[node] == generation + 1)
+            return;
+
+        if (state[node] == generation && cost[node] <= g)
+            return;
+
+        state[node] = generation;
+        cost[node] = g;
+        parent[node] = from;
+        heap.emplace_back(f, node);
+        std::push_heap(heap.begin(), heap.end(), std::greater<>());
+    }
+
+    /// @brief Pop the best open node and close it, skipping stale heap entries.
+
+    int next() {
+        while (!heap.empty()) {
+            std::pop_heap(heap.begin(), heap.end(), std::greater<>());
+            auto const node = heap.back().second;
+            heap.pop_back();
+
+            if (state[node] == generation) {
+                state[node] = generation + 1;
+                return node;
+            }
+        }
+
+        return none;
+    }
+
+    /// @brief Write the cells of the path that ends at the goal, interpolating between jump points if necessary.
+
+    bool trace(std::vector<position>& path, bool const interpolate) {
+        length = cost[goal];
+
+        for (auto node = goal;; node = parent[node]) {
+            path.emplace_back(node / cols, node % cols);
+
+            if (parent[node] == node)
+                break;
+
+            if (interpolate) {
+                auto const p = parent[node];
+                auto const dy = sign(p / cols - node / cols);
+                auto const dx = sign(p % cols - node % cols);
+
+                for (auto y = node / cols + dy, x = node % cols + dx; index_of(y, x) != p; y += dy, x += dx) {
+                    path.emplace_back(y, x);
+                }
+            }
+        }
+
+        std::reverse(path.begin(), path.end());
+        return true;
+    }
+
+    /// @brief Collect the directions worth exploring from a node that was reached in the given direction.
+
+    void prune(int const y, int const x, int const dy, int const dx) {
+        if (dy == 0 && dx == 0) {
+            for (auto sy = -1; sy <= 1; ++sy) {
+                for (auto sx = -1; sx <= 1; ++sx) {
+                    if ((sy != 0 || sx != 0) && walkable(y + sy, x + sx)
+                        && (sy == 0 || sx == 0 || (walkable(y + sy, x) && walkable(y, x + sx))))
+                        successors.emplace_back(sy, sx);
+                }
+            }
+
+            return;
+        }
+
+        if (dy != 0 && dx != 0) {
+            auto const vertical = walkable(y + dy, x);
+            auto const horizontal = walkable(y, x + dx);
+
+            if (vertical) successors.emplace_back(dy, 0);
+            if (horizontal) successors.emplace_back(0, dx);
+            if (vertical && horizontal) successors.emplace_back(dy, dx);
+
+            return;
+        }
+
+        if (dx != 0) {
+            auto const ahead = walkable(y, x + dx);
+            auto const above = walkable(y - 1, x);
+            auto const below = walkable(y + 1, x);
+
+            if (ahead) successors.emplace_back(0, dx);
+            if (ahead && above) successors.emplace_back(-1, dx);
+            if (ahead && below) successors.emplace_back(1, dx);
+            if (above) successors.emplace_back(-1, 0);
+            if (below) successors.emplace_back(1, 0);
+
+            return;
+        }
+
+        auto const ahead = walkable(y + dy, x);
+        auto const left = walkable(y, x - 1);
+        auto const right = walkable(y, x + 1);
+
+        if (ahead) successors.emplace_back(dy, 0);
+        if (ahead && left) successors.emplace_back(dy, -1);
+        if (ahead && right) successors.emplace_back(dy, 1);
+        if (left) successors.emplace_back(0, -1);
+        if (right) successors.emplace_back(0, 1);
+    }
+
+    /// @brief Travel from the given cell in the given direction until a jump point is found.
+    /// @return The table index of the jump point, or `none` if the direction is a dead end.
+
+    int jump(int y, int x, int const dy, int const dx) const {
+        while (walkable(y, x)) {
+            auto const t = index_of(y, x);
+            if (t == goal)
+                return t;
+
+            if (dy != 0 && dx != 0) {
+                if (jump(y, x + dx, 0, dx) != none || jump(y + dy, x, dy, 0) != none)
+                    return t;
+
+                if (!(walkable(y + dy, x) && walkable(y, x + dx)))
+                    return none;
+            } else if (dx != 0) {
+                if ((walkable(y - 1, x) && !walkable(y - 1, x - dx)) || (walkable(y + 1, x) && !walkable(y + 1, x - dx)))
+                    return t;
+            } else {
+                if ((walkable(y, x - 1) && !walkable(y - dy, x - 1)) || (walkable(y, x + 1) && !walkable(y - dy, x + 1)))
+                    return t;
+            }
+
+            y = y + dy;
+            x = x + dx;
+        }
+
+        return none;
+    }
+
+    [[nodiscard]]
+    inline bool inside(int const y, int const x) const noexcept {
+        return y >= 0 && x >= 0 && y < rows && x < cols;
+    }
+
+    [[nodiscard]]
+    inline bool walkable(int const y, int const x) const noexcept {
+        return inside(y, x) && lookup[layout.index(y, x)] == empty;
+    }
+
+    [[nodiscard]]
+    inline int index_of(int const y, int const x) const noexcept {
+        return y * cols + x;
+    }
+
+    [[nodiscard]]
+    inline float heuristic(int const y, int const x) const noexcept {
+        return octile(std::abs(y - goal / cols), std::abs(x - goal % cols));
+    }
+
+    [[nodiscard]]
+    inline static float octile(int const dy, int const dx) noexcept {
+        auto constexpr diagonal = 1.41421356f;
+        return static_cast<float>(std::max(dy, dx)) + (diagonal - 1.0f) * static_cast<float>(std::min(dy, dx));
+    }
+
+    [[nodiscard]]
+    inline static int sign(int const value) noexcept {
+        return (value > 0) - (value < 0);
+    }
+
+private:
+    std::vector<float> cost;
+    std::vector<int> parent;
+    std::vector<std::uint32_t> state;
+    std::vector<std::pair<float, int>> heap;
+    std::vector<std::pair<int, int>> successors;
+
+    std::uint32_t generation {0};
+    float length {0.0f};
+    int goal {0};
+    int rows {0};
+    int cols {0};
+
+    int const* lookup {nullptr};
+    ring_layout layout {};
+    int empty {0};
+
+    auto inline static constexpr none {-1};
+};
+
+}
+
+#endif
@@ -0,0 +1,251 @@
+#ifndef TABLE_SERIALIZE_HPP
+#define TABLE_SERIALIZE_HPP
+
+#include <vector>
+#include <climits>
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <utility>
+#include <istream>
+#include <ostream>
+#include <algorithm>
+#include <stdexcept>
+#include <type_traits>
+
+#include "../table.hpp"
+
+namespace ds {
+
+/// @brief Write the given unsigned integer as a little-endian base-128 varint.
+/// @throws `std::runtime_error` if the stream cannot be written to.
+
+inline void write_varint(std::streambuf& out, std::uint64_t value) {
+    auto const put = [&](char const byte) {
+        if (out.sputc(byte) == std::char_traits<char>::eof())
+            throw std::runtime_error("ds::write_varint: failed to write to stream");
+    };
+
+    while (value >= 0x80) {
+        put(static_cast<char>((value & 0x7f) | 0x80));
+        value >>= 7;
+    }
+
+    put(static_cast<char>(value));
+}
+
+/// @brief Read a little-endian base-128 varint.
+/// @throws `std::runtime_error` if the stream ends before the varint does.
+
+inline std::uint64_t read_varint(std::streambuf& in) {
+    auto value = std::uint64_t {0};
+
+    for (auto shift = 0; shift < 64; shift += 7) {
+        auto const byte = in.sbumpc();
+        if (byte == std::char_traits<char>::eof())
+            throw std::runtime_error("ds::read_varint: unexpected end of stream");
+
+        value |= static_cast<std::uint64_t>(byte & 0x7f) << shift;
+        if ((byte & 0x80) == 0)
+            return value;
+    }
+
+    throw std::runtime_error("ds::read_varint: malformed varint");
+}
+
+/// @class Raw codec
+/// @brief A value codec that copies the bytes of a trivially copyable value.
+
+template<typename value_type>
+struct raw_codec {
+    static_assert(std::is_trivially_copyable_v<value_type>, "ds::raw_codec requires a trivially copyable type");
+
+    inline void encode(value_type const& value, std::streambuf& out) const {
+        if (out.sputn(reinterpret_cast<char const*>(&value), sizeof(value_type)) != sizeof(value_type))
+            throw std::runtime_error("ds::raw_codec: failed to write to stream");
+    }
+
+    inline value_type decode(std::streambuf& in) const {
+        value_type value;
+        if (in.sgetn(reinterpret_cast<char*>(&value), sizeof(value_type)) != sizeof(value_type))
+            throw std::runtime_error("ds::raw_codec: unexpected end of stream");
+
+        return value;
+    }
+};
+
+/// @class Varint codec
+/// @brief A value codec that writes integers as zigzag-encoded varints, so that small magnitudes take few bytes.
+
+template<typename value_type>
+struct varint_codec {
+    static_assert(std::is_integral_v<value_type>, "ds::varint_codec requires an integral type");
+
+    inline void encode(value_type const& value, std::streambuf& out) const {
+        if constexpr (std::is_signed_v<value_type>) {
+            auto const wide = static_cast<std::int64_t>(value);
+            write_varint(out, (static_cast<std::uint64_t>(wide) << 1) ^ static_cast<std::uint64_t>(wide >> 63));
+        } else {
+            write_varint(out, static_cast<std::uint64_t>(value));
+        }
+    }
+
+    inline value_type decode(std::streambuf& in) const {
+        auto const bits = read_varint(in);
+
+        if constexpr (std::is_signed_v<value_type>) {
+            return static_cast<value_type>(static_cast<std::int64_t>(bits >> 1) ^ -static_cast<std::int64_t>(bits & 1));
+        } else {
+            return static_cast<value_type>(bits);
+        }
+    }
+};
+
+/// @brief The encoding of the positions of the occupied cells.
+/// @note `deltas` writes the gap before each occupied cell, in row-major order.
+/// `runs` writes the gap before each run of consecutive occupied cells and the length of the run.
+/// `automatic` chooses whichever is smaller.
+
+enum class occupancy_encoding {
+    deltas,
+    runs,
+    automatic
+};
+
+namespace serialization {
+auto inline constexpr magic = "DSTB";
+std::uint8_t inline constexpr version {1};
+std::uint8_t inline constexpr runs_flag {1};
+}
+
+/// @brief Write the given table to the given stream in a compressed binary format.
+/// @param table The table to be written.
+/// @param stream The stream to be written to.
+/// @param encoding The encoding of the positions of the occupied cells.
+/// @param codec The codec that writes each data item, with the signature `void encode(value_type const&, std::streambuf&)`.
+/// @note The data items are written in row-major order, interleaved with the varint-encoded gaps between them.
+/// @throws `std::runtime_error` if the stream cannot be written to.
+
+template<typename grid, typename codec_type = raw_codec<std::decay_t<decltype(*std::declval<grid const&>().data())>>>
+void save(grid const& table, std::ostream& stream,
+          occupancy_encoding encoding = occupancy_encoding::automatic, codec_type const& codec = {}) {
+    auto const [rows, cols] = table.dimensions();
+    auto const count = table.count();
+    auto const data = table.data();
+    auto const indices = table.indices();
+    auto const layout = layout_of(table);
+
+    std::vector<std::pair<int, std::size_t>> order;
+    order.reserve(count);
+
+    for (auto i = std::size_t {0}; i < count; ++i) {
+        auto const [row, column] = layout.position(indices[i]);
+        order.emplace_back(row * static_cast<int>(cols) + column, i);
+    }
+
+    std::sort(order.begin(), order.end());
+
+    auto runs = std::size_t {0};
+    for (auto k = std::size_t {0}; k < count; ++k) {
+        runs += k == 0 || order[k].first != order[k - 1].first + 1;
+    }
+
+    if (encoding == occupancy_encoding::automatic)
+        encoding = 2 * runs < count ? occupancy_encoding::runs : occupancy_encoding::deltas;
+
+    if (!stream)
+        throw std::runtime_error("ds::save: failed to write to stream");
+
+    char const header[6] {
+        serialization::magic[0], serialization::magic[1], serialization::magic[2], serialization::magic[3],
+        static_cast<char>(serialization::version),
+        static_cast<char>(encoding == occupancy_encoding::runs ? serialization::runs_flag : 0)
+    };
+
+    auto& out = *stream.rdbuf();
+    if (out.sputn(header, 6) != 6)
+        throw std::runtime_error("ds::save: failed to write to stream");
+
+    write_varint(out, rows);
+    write_varint(out, cols);
+    write_varint(out, count);
+
+    auto next = std::int64_t {0};
+
+    for (auto k = std::size_t {0}; k < count;) {
+        auto const t = order[k].first;
+        write_varint(out, static_cast<std::uint64_t>(t - next));
+
+        auto length = std::size_t {1};
+        if (encoding == occupancy_encoding::runs) {
+            while (k + length < count && order[k + length].first == t + static_cast<int>(length)) ++length;
+            write_varint(out, length);
+        }
+
+        for (auto j = k; j < k + length; ++j) {
+            codec.encode(data[order[j].second], out);
+        }
+
+        next = t + static_cast<std::int64_t>(length);
+        k = k + length;
+    }
+}
+
+/// @brief Read a table that was written by `ds::save` from the given stream.
+/// @tparam grid The type of the table to be read.
+/// @param stream The stream to be read from.
+/// @param codec The codec that reads each data item, with the signature `value_type decode(std::streambuf&)`.
+/// @return The table.
+/// @note The table is built in a single pass after reserving capacity for its data items.
+/// @throws `std::runtime_error` if the stream does not hold a valid table, or if the table has more than `INT_MAX` cells.
+
+template<typename grid, typename codec_type = raw_codec<std::decay_t<decltype(*std::declval<grid const&>().data())>>>
+grid load(std::istream& stream, codec_type const& codec = {}) {
+    auto& in = *stream.rdbuf();
+
+    char header[6];
+    if (in.sgetn(header, 6) != 6 || std::memcmp(header, serialization::magic, 4) != 0)
+        throw std::runtime_error("ds::load: missing table header");
+
+    if (static_cast<std::uint8_t>(header[4]) != serialization::version)
+        throw std::runtime_error("ds::load: unsupported version");
+
+    auto const runs = (static_cast<std::uint8_t>(header[5]) & serialization::runs_flag) != 0;
+    auto const rows = read_varint(in);
+    auto const cols = read_varint(in);
+    auto const count = read_varint(in);
+
+    auto constexpr limit = static_cast<std::uint64_t>(INT_MAX);
+    if (rows > limit || cols > limit || (cols != 0 && rows > limit / cols))
+        throw std::runtime_error("ds::load: the table is too large");
+
+    if (count > rows * cols)
+        throw std::runtime_error("ds::load: too many data items");
+
+    grid table(rows, cols);
+    table.reserve(count);
+
+    auto t = std::uint64_t {0};
+    for (auto k = std::uint64_t {0}; k < count;) {
+        auto const gap = read_varint(in);
+        if (gap > rows * cols - t)
+            throw std::runtime_error("ds::load: data item out of bounds");
+
+        t = t + gap;
+        auto const length = runs ? read_varint(in) : 1;
+        if (length == 0 || length > count - k || t + length > rows * cols)
+            throw std::runtime_error("ds::load: data item out of bounds");
+
+        for (auto j = std::uint64_t {0}; j < length; ++j, ++t) {
+            table.emplace(static_cast<int>(t / cols), static_cast<int>(t % cols), codec.decode(in));
+        }
+
+        k = k + length;
+    }
+
+    return table;
+}
+
+}
+
+#endif
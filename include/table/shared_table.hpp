@@ -0,0 +1,565 @@
+#ifndef TABLE_SHARED_TABLE_HPP
+#define TABLE_SHARED_TABLE_HPP
+
+#if !__has_include(<sys/mman.h>) || !__has_include(<unistd.h>)
+#error "table/shared_table.hpp requires POSIX shared memory."
+#endif
+
+#include <new>
+#include <atomic>
+#include <string>
+#include <cerrno>
+#include <climits>
+#include <optional>
+#include <cstdint>
+#include <cstddef>
+#include <utility>
+#include <algorithm>
+#include <stdexcept>
+#include <type_traits>
+#include <system_error>
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "../table.hpp"
+
+namespace ds {
+
+/// @brief The header at the start of a mapped table's region, which locates the table's arrays by their offsets
+/// from the start of the region so that the region can be mapped at a different address by each process.
+
+struct mapped_header {
+    std::uint64_t magic;
+    std::uint32_t version;
+    std::uint32_t value_size;
+    std::uint64_t rows;
+    std::uint64_t cols;
+    std::uint64_t capacity;
+    std::uint64_t count;
+    std::uint64_t table_indices_offset;
+    std::uint64_t cells_indices_offset;
+    std::uint64_t cells_offset;
+    std::uint64_t generation;
+    std::uint64_t synced;
+    std::uint64_t dirty;
+    std::atomic<std::uint64_t> sequence;
+
+    std::uint64_t static constexpr expected_magic {0x454c4241545f5344};
+    std::uint32_t static constexpr expected_version {3};
+};
+
+static_assert(std::atomic<std::uint64_t>::is_always_lock_free, "ds::mapped_header requires a lock-free 64-bit atomic");
+
+/// @class Mapped table
+/// @brief A table of trivially copyable values whose lookup table, cell indices and cells live in a single
+/// region of memory that it does not own, such as a mapping of shared memory or of a file.
+/// @note The region holds no pointers, only offsets, and has a fixed capacity. Writes are versioned with a
+/// seqlock: the sequence number in the header is odd while a write is in progress, so a reader can check
+/// that nothing changed while it read, and retry if something did. There must be one writer at a time.
+
+template<typename value_type>
+class mapped_table {
+    static_assert(std::is_trivially_copyable_v<value_type>, "ds::mapped_table requires a trivially copyable type");
+
+public:
+    mapped_table(mapped_table const&) = delete;
+    mapped_table& operator=(mapped_table const&) = delete;
+
+public:
+    /// @brief Get the dimensions of the table.
+    /// @return The dimensions of the table, (rows, cols).
+
+    [[nodiscard]]
+    inline std::pair<std::size_t, std::size_t> dimensions() const noexcept {
+        return {static_cast<std::size_t>(header->rows), static_cast<std::size_t>(header->cols)};
+    }
+
+    /// @brief Get the number of data items stored in the table.
+
+    [[nodiscard]]
+    inline std::size_t count() const noexcept {
+        return static_cast<std::size_t>(header->count);
+    }
+
+    /// @brief Get the maximum number of data items that the table can hold.
+
+    [[nodiscard]]
+    inline std::size_t capacity() const noexcept {
+        return static_cast<std::size_t>(header->capacity);
+    }
+
+    /// @brief Get the sequence number of the table, which is odd while a write is in progress and increases with each write.
+
+    [[nodiscard]]
+    inline std::uint64_t version() const noexcept {
+        return header->sequence.load(std::memory_order_acquire);
+    }
+
+    /// @brief Get a pointer to the contents of the table cell at the given position.
+    /// @return A pointer to the contents of the cell, or `nullptr` if the cell is empty or refers past the last data item,
+    /// as it may while a write is in progress.
+    /// @throws `std::out_of_range` if the position lies outside of the table.
+    /// @note If another process may be writing, this should be called within `read`.
+
+    inline value_type const* get(int const row, int const column) const {
+        auto const i = table_indices[get_table_index(row, column)];
+        return i >= 0 && static_cast<std::uint64_t>(i) < header->count ? cells + i : nullptr;
+    }
+
+    /// @brief Indicate whether the table cell at the given position contains an element or not.
+    /// @see `ds::mapped_table::get`
+
+    [[nodiscard]]
+    inline bool contains(int const row, int const column) const {
+        auto const i = table_indices[get_table_index(row, column)];
+        return i >= 0 && static_cast<std::uint64_t>(i) < header->count;
+    }
+
+    /// @brief Get a pointer to the underlying array of data items, which holds `count()` items.
+
+    inline value_type const* data() const noexcept {
+        return cells;
+    }
+
+    /// @brief Get a pointer to the underlying lookup table, which holds `rows * cols` indices.
+
+    inline int const* lookup() const noexcept {
+        return table_indices;
+    }
+
+    /// @brief Get a pointer to the underlying array of the table indices of each data item.
+
+    inline int const* indices() const noexcept {
+        return cells_indices;
+    }
+
+    /// @brief Invoke the given task with a consistent view of the table, retrying it if a write overlapped.
+    /// @param task A function with the signature `result(mapped_table const& table)`.
+    /// @return The result of the last invocation of the task.
+    /// @note The task may be invoked more than once and may observe a partially written table on the
+    /// invocations that are retried, so it should only read the table and copy out what it needs.
+    /// @note If the writer dies during a write, the sequence number stays odd and this retries forever.
+    /// Readers that cannot trust the writer should use `try_read` and call `recover` once the writer is known to be gone.
+
+    template<typename task_function>
+    auto read(task_function&& task) const {
+        for (;;) {
+            auto const before = header->sequence.load(std::memory_order_acquire);
+            if (before & 1)
+                continue;
+
+            if constexpr (std::is_void_v<std::invoke_result_t<task_function&, mapped_table const&>>) {
+                task(*this);
+                std::atomic_thread_fence(std::memory_order_acquire);
+                if (header->sequence.load(std::memory_order_relaxed) == before)
+                    return;
+            } else {
+                auto result = task(*this);
+                std::atomic_thread_fence(std::memory_order_acquire);
+                if (header->sequence.load(std::memory_order_relaxed) == before)
+                    return result;
+            }
+        }
+    }
+
+    /// @brief Invoke the given task with a consistent view of the table, giving up after the given number of attempts.
+    /// @param task A function with the signature `result(mapped_table const& table)`.
+    /// @param attempts The maximum number of times that the sequence number is checked.
+    /// @return The result of the task, or `std::nullopt` if no attempt observed a consistent view. If the task returns `void`,
+    /// whether an attempt observed a consistent view.
+    /// @see `ds::mapped_table::read`
+
+    template<typename task_function>
+    auto try_read(task_function&& task, std::size_t const attempts) const {
+        using result_type = std::invoke_result_t<task_function&, mapped_table const&>;
+        using return_type = std::conditional_t<std::is_void_v<result_type>, bool, std::optional<result_type>>;
+
+        for (auto k = std::size_t {0}; k < attempts; ++k) {
+            auto const before = header->sequence.load(std::memory_order_acquire);
+            if (before & 1)
+                continue;
+
+            if constexpr (std::is_void_v<result_type>) {
+                task(*this);
+                std::atomic_thread_fence(std::memory_order_acquire);
+                if (header->sequence.load(std::memory_order_relaxed) == before)
+                    return true;
+            } else {
+                auto result = task(*this);
+                std::atomic_thread_fence(std::memory_order_acquire);
+                if (header->sequence.load(std::memory_order_relaxed) == before)
+                    return return_type(std::move(result));
+            }
+        }
+
+        return return_type {};
+    }
+
+    /// @brief Copy the contents of the table cell at the given position from a consistent view of the table.
+    /// @return `true` if the cell was occupied and its contents were copied into `element`, or `false` otherwise.
+    /// @note This retries until it observes a consistent view, as `read` does.
+
+    bool read(int const row, int const column, value_type& element) const {
+        auto const t = get_table_index(row, column);
+        return read([&](mapped_table const&) {
+            auto const i = table_indices[t];
+            if (i < 0 || static_cast<std::uint64_t>(i) >= header->count)
+                return false;
+
+            element = cells[i];
+            return true;
+        });
+    }
+
+public:
+    /// @brief Set the value of the table cell at the given position.
+    /// @throws `std::out_of_range` if the position lies outside of the table, or `std::length_error` if the cell is empty and the table is full.
+
+    void set(int const row, int const column, value_type const& element) {
+        auto const t = get_table_index(row, column);
+        auto const i = table_indices[t];
+
+        if (i == none && header->count == header->capacity)
+            throw std::length_error("ds::mapped_table: the table is full");
+
+        write_section const section(*this);
+        if (i != none) {
+            cells[i] = element;
+            return;
+        }
+
+        auto const n = static_cast<int>(header->count);
+        cells[n] = element;
+        cells_indices[n] = t;
+        table_indices[t] = n;
+        header->count += 1;
+    }
+
+    /// @brief Erase the contents of the table cell at the given position.
+    /// @throws `std::out_of_range` if the position lies outside of the table or the cell is empty.
+
+    void erase(int const row, int const column) {
+        auto const t = get_table_index(row, column);
+        auto const i = table_indices[t];
+
+        if (i == none)
+            throw std::out_of_range("ds::mapped_table: the cell is empty");
+
+        write_section const section(*this);
+        auto const last = static_cast<int>(header->count) - 1;
+        if (i != last) {
+            cells[i] = cells[last];
+            cells_indices[i] = cells_indices[last];
+            table_indices[cells_indices[i]] = i;
+        }
+
+        table_indices[t] = none;
+        header->count -= 1;
+    }
+
+    /// @brief Erase every data item.
+    /// @note The amount of time required is linear in the number of data items.
+
+    void reset() {
+        write_section const section(*this);
+        for (auto i = std::uint64_t {0}; i < header->count; ++i) {
+            table_indices[cells_indices[i]] = none;
+        }
+
+        header->count = 0;
+    }
+
+    /// @brief Invoke the given task as a single write, so that readers observe either none or all of its changes.
+    /// @param task A function with the signature `void(mapped_table& table)`, which may call `set`, `erase` and `reset`.
+
+    template<typename task_function>
+    void write(task_function&& task) {
+        write_section const section(*this);
+        task(*this);
+    }
+
+    /// @brief Restore the table if a write was interrupted, such as by the death of the writing process, so that readers stop retrying.
+    /// @return `true` if a write was interrupted and the table was repaired, or `false` if the table was left unchanged.
+    /// @note This must only be called once the writer is known to be gone, since it writes the table.
+    /// The amount of time required is linear in the size of the table.
+
+    bool recover() noexcept {
+        if ((header->sequence.load(std::memory_order_acquire) & 1) == 0)
+            return false;
+
+        repair();
+        return true;
+    }
+
+protected:
+    mapped_table() = default;
+
+    /// @brief Compute the offsets of the arrays of a table with the given dimensions and capacity and write them to the given header.
+    /// @param reserved The capacity that the array of cell indices should have room for, so that the table can grow to it without moving its cells.
+    /// @return The size of the region in bytes.
+
+    static std::size_t layout(mapped_header& h, std::size_t const rows, std::size_t const cols, std::size_t const capacity, std::size_t const reserved = 0) {
+        auto const align = [](std::size_t const offset, std::size_t const alignment) {
+            return (offset + alignment - 1) / alignment * alignment;
+        };
+
+        auto const room = std::max(capacity, reserved);
+        if (rows * cols > static_cast<std::size_t>(INT_MAX) || room > static_cast<std::size_t>(INT_MAX))
+            throw std::length_error("ds::mapped_table: the table is too large");
+
+        h.rows = rows;
+        h.cols = cols;
+        h.capacity = capacity;
+        h.table_indices_offset = align(sizeof(mapped_header), 64);
+        h.cells_indices_offset = align(h.table_indices_offset + rows * cols * sizeof(int), 64);
+        h.cells_offset = align(h.cells_indices_offset + room * sizeof(int), std::max<std::size_t>(64, alignof(value_type)));
+
+        return h.cells_offset + capacity * sizeof(value_type);
+    }
+
+    /// @brief Construct an empty table in the given region, which must be at least `layout` bytes long.
+
+    void create(void* const region, std::size_t const rows, std::size_t const cols, std::size_t const capacity, std::size_t const reserved = 0) {
+        auto const h = new (region) mapped_header {};
+        layout(*h, rows, cols, capacity, reserved);
+        h->version = mapped_header::expected_version;
+        h->value_size = sizeof(value_type);
+        h->count = 0;
+
+        attach(region);
+        std::fill(table_indices, table_indices + rows * cols, none);
+
+        std::atomic_thread_fence(std::memory_order_release);
+        h->magic = mapped_header::expected_magic;
+    }
+
+    /// @brief Attach to the table in the given region, which is `size` bytes long.
+    /// @throws `std::runtime_error` if the region does not hold a table of this value type.
+
+    void open(void* const region, std::size_t const size) {
+        auto const h = static_cast<mapped_header*>(region);
+        if (size < sizeof(mapped_header) || h->magic != mapped_header::expected_magic)
+            throw std::runtime_error("ds::mapped_table: the region does not hold a table");
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (h->version != mapped_header::expected_version || h->value_size != sizeof(value_type) ||
+            h->rows * h->cols > static_cast<std::uint64_t>(INT_MAX) || h->capacity > static_cast<std::uint64_t>(INT_MAX) ||
+            h->table_indices_offset < sizeof(mapped_header) || h->table_indices_offset % alignof(int) != 0 ||
+            h->cells_indices_offset < h->table_indices_offset + h->rows * h->cols * sizeof(int) || h->cells_indices_offset % alignof(int) != 0 ||
+            h->cells_offset < h->cells_indices_offset + h->capacity * sizeof(int) || h->cells_offset % alignof(value_type) != 0 ||
+            size < h->cells_offset + h->capacity * sizeof(value_type))
+            throw std::runtime_error("ds::mapped_table: the region holds an incompatible table");
+
+        attach(region);
+    }
+
+    /// @brief Indicate whether the table was written since it was last synchronised, or a write was interrupted.
+
+    [[nodiscard]]
+    inline bool unsynchronised() const noexcept {
+        auto const sequence = header->sequence.load(std::memory_order_relaxed);
+        return (sequence & 1) != 0 || header->synced != sequence;
+    }
+
+    /// @brief Indicate whether the lookup table and the table indices of the data items refer to each other,
+    /// so that every occupied cell refers to one of the first `count` data items and each data item refers back to its cell.
+    /// @note The amount of time required is linear in the size of the table.
+
+    [[nodiscard]]
+    bool consistent() const noexcept {
+        auto const cells_count = header->rows * header->cols;
+        auto const count = header->count;
+        if (count > header->capacity)
+            return false;
+
+        for (auto t = std::uint64_t {0}; t < cells_count; ++t) {
+            auto const i = table_indices[t];
+            if (i != none && (i < 0 || static_cast<std::uint64_t>(i) >= count || static_cast<std::uint64_t>(cells_indices[i]) != t))
+                return false;
+        }
+
+        for (auto i = std::uint64_t {0}; i < count; ++i) {
+            auto const t = cells_indices[i];
+            if (t < 0 || static_cast<std::uint64_t>(t) >= cells_count || static_cast<std::uint64_t>(table_indices[t]) != i)
+                return false;
+        }
+
+        return true;
+    }
+
+    /// @brief Restore the invariants of a table whose writes may have been interrupted or partially persisted.
+    /// @note The lookup table is rebuilt from the table indices of the data items. Each data item whose table index
+    /// is invalid or duplicated is dropped. The amount of time required is linear in the size of the table.
+
+    void repair() noexcept {
+        auto const cells_count = header->rows * header->cols;
+        auto count = std::min(header->count, header->capacity);
+        std::fill(table_indices, table_indices + cells_count, none);
+
+        for (auto i = std::uint64_t {0}; i < count;) {
+            auto const t = cells_indices[i];
+            if (t >= 0 && static_cast<std::uint64_t>(t) < cells_count && table_indices[t] == none) {
+                table_indices[t] = static_cast<int>(i++);
+                continue;
+            }
+
+            --count;
+            cells[i] = cells[count];
+            cells_indices[i] = cells_indices[count];
+        }
+
+        header->count = count;
+        header->sequence.store((header->sequence.load(std::memory_order_relaxed) + 1) & ~std::uint64_t {1}, std::memory_order_release);
+    }
+
+    /// @brief Point the table's arrays into the given region using the offsets in its header.
+
+    void attach(void* const region) noexcept {
+        auto const base = static_cast<unsigned char*>(region);
+        header = static_cast<mapped_header*>(region);
+        table_indices = reinterpret_cast<int*>(base + header->table_indices_offset);
+        cells_indices = reinterpret_cast<int*>(base + header->cells_indices_offset);
+        cells = reinterpret_cast<value_type*>(base + header->cells_offset);
+    }
+
+private:
+    /// @brief A scope in which the table is being written. The sequence number is odd within the outermost scope.
+
+    struct write_section {
+        explicit write_section(mapped_table& t) noexcept: table(t) {
+            if (table.depth++ == 0) {
+                table.header->sequence.fetch_add(1, std::memory_order_relaxed);
+                std::atomic_thread_fence(std::memory_order_release);
+            }
+        }
+
+        ~write_section() {
+            if (--table.depth == 0)
+                table.header->sequence.fetch_add(1, std::memory_order_release);
+        }
+
+        mapped_table& table;
+    };
+
+    inline int get_table_index(int const row, int const column) const {
+        if (row < 0 || column < 0 || static_cast<std::uint64_t>(row) >= header->rows || static_cast<std::uint64_t>(column) >= header->cols)
+            throw std::out_of_range("ds::mapped_table: position out of range");
+
+        return row * static_cast<int>(header->cols) + column;
+    }
+
+public:
+    /// @brief The value reserved to represent the absence of an item.
+
+    auto inline static constexpr none {-INT_MAX};
+
+protected:
+    mapped_header* header {nullptr};
+    int* table_indices {nullptr};
+    int* cells_indices {nullptr};
+    value_type* cells {nullptr};
+
+private:
+    int depth {0};
+};
+
+/// @class Shared table
+/// @brief A mapped table in a POSIX shared memory object, which processes on the same host can map to read
+/// the same table without copying it.
+/// @note The creating process writes the table and the other processes read it through `read`.
+/// The shared memory object persists until it is removed with `ds::shared_table::unlink`.
+/// @example `ds::shared_table<tile> board("/board", 4096, 4096, 1 << 20);`
+
+template<typename value_type>
+class shared_table: public mapped_table<value_type> {
+public:
+    /// @brief Create an empty table in a new shared memory object with the given name.
+    /// @param name The name of the shared memory object, such as "/board".
+    /// @param number_of_rows The desired number of rows.
+    /// @param number_of_cols The desired number of columns.
+    /// @param capacity The maximum number of data items that the table can hold.
+    /// @throws `std::system_error` if the shared memory object already exists or cannot be created.
+
+    shared_table(std::string const& name, std::size_t const number_of_rows, std::size_t const number_of_cols, std::size_t const capacity) {
+        auto h = mapped_header {};
+        size = this->layout(h, number_of_rows, number_of_cols, capacity);
+
+        auto const descriptor = ::shm_open(name.c_str(), O_RDWR | O_CREAT | O_EXCL, 0600);
+        if (descriptor < 0)
+            throw std::system_error(errno, std::generic_category(), "ds::shared_table: failed to create " + name);
+
+        if (::ftruncate(descriptor, static_cast<off_t>(size)) != 0) {
+            auto const error = errno;
+            ::close(descriptor);
+            ::shm_unlink(name.c_str());
+            throw std::system_error(error, std::generic_category(), "ds::shared_table: failed to size " + name);
+        }
+
+        try {
+            map(descriptor, name);
+        } catch (...) {
+            ::shm_unlink(name.c_str());
+            throw;
+        }
+
+        this->create(region, number_of_rows, number_of_cols, capacity);
+    }
+
+    /// @brief Open the table in the existing shared memory object with the given name.
+    /// @throws `std::system_error` if the shared memory object cannot be opened, or `std::runtime_error` if it does not hold a table of this value type.
+
+    explicit shared_table(std::string const& name) {
+        auto const descriptor = ::shm_open(name.c_str(), O_RDWR, 0);
+        if (descriptor < 0)
+            throw std::system_error(errno, std::generic_category(), "ds::shared_table: failed to open " + name);
+
+        struct stat status {};
+        if (::fstat(descriptor, &status) != 0) {
+            auto const error = errno;
+            ::close(descriptor);
+            throw std::system_error(error, std::generic_category(), "ds::shared_table: failed to open " + name);
+        }
+
+        size = static_cast<std::size_t>(status.st_size);
+        map(descriptor, name);
+
+        try {
+            this->open(region, size);
+        } catch (...) {
+            ::munmap(region, size);
+            throw;
+        }
+    }
+
+    ~shared_table() {
+        ::munmap(region, size);
+    }
+
+    /// @brief Remove the shared memory object with the given name. Processes that have mapped it can continue to use it.
+    /// @return `true` if the object was removed, or `false` if it did not exist.
+
+    static bool unlink(std::string const& name) noexcept {
+        return ::shm_unlink(name.c_str()) == 0;
+    }
+
+private:
+    void map(int const descriptor, std::string const& name) {
+        region = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, descriptor, 0);
+        auto const error = errno;
+        ::close(descriptor);
+
+        if (region == MAP_FAILED)
+            throw std::system_error(error, std::generic_category(), "ds::shared_table: failed to map " + name);
+    }
+
+private:
+    void* region {nullptr};
+    std::size_t size {0};
+};
+
+}
+
+#endif
@@ -0,0 +1,264 @@
+#ifndef TABLE_WINDOW_HPP
+#define TABLE_WINDOW_HPP
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <utility>
+#include <stdexcept>
+#include <type_traits>
+
+#include "../table.hpp"
+
+namespace ds {
+
+/// @class Sliding window
+/// @brief A table of the most recent rows of a time series, where each row is a time step and each column is a series,
+/// with per-column aggregates over the window that are maintained incrementally.
+/// @note Rows are stored in a table whose origin is scrolled by one row per push, so appending a row and
+/// dropping the oldest takes time proportional to cols plus the number of items in those rows.
+/// The minimum and maximum of each column are maintained by monotonic queues of fixed capacity.
+/// @example `ds::sliding_window<float> metrics(60, 8);`
+
+template<typename value_type>
+class sliding_window {
+    static_assert(std::is_arithmetic_v<value_type>, "ds::sliding_window requires an arithmetic type");
+
+    struct entry {
+        std::uint64_t step;
+        value_type value;
+    };
+
+    struct queue {
+        std::size_t head {0};
+        std::size_t size {0};
+    };
+
+public:
+    /// @brief Construct an empty window.
+    /// @param number_of_rows The number of rows that the window holds before the oldest is dropped.
+    /// @param number_of_cols The number of series.
+
+    sliding_window(std::size_t const number_of_rows, std::size_t const number_of_cols):
+            grid(number_of_rows, number_of_cols),
+            column_sums(number_of_cols, value_type {}),
+            column_counts(number_of_cols, 0),
+            minima(number_of_rows * number_of_cols),
+            maxima(number_of_rows * number_of_cols),
+            minimum_queues(number_of_cols),
+            maximum_queues(number_of_cols),
+            seen(number_of_cols, 0) {
+        if (number_of_rows == 0)
+            throw std::invalid_argument("ds::sliding_window: the window must hold at least one row");
+    }
+
+public:
+    /// @brief Append a row, dropping the oldest row if the window is full.
+    /// @param first An iterator to the first (column, value) pair of the new row.
+    /// @param last An iterator past the last (column, value) pair of the new row.
+    /// @note Columns that do not appear are empty in the new row. The columns are validated before the window
+    /// is changed, so the range is traversed twice.
+    /// @throws `std::out_of_range` if a column lies outside of the window, or `std::invalid_argument` if a column appears more than once.
+
+    template<typename forward_iterator>
+    void push_row(forward_iterator first, forward_iterator last) {
+        auto const [rows, cols] = grid.dimensions();
+        auto const stamp = ++validations;
+        for (auto item = first; item != last; ++item) {
+            auto const column = static_cast<std::ptrdiff_t>(item->first);
+            if (column < 0 || column >= static_cast<std::ptrdiff_t>(cols))
+                throw std::out_of_range("ds::sliding_window: column out of range");
+
+            if (seen[static_cast<std::size_t>(column)] == stamp)
+                throw std::invalid_argument("ds::sliding_window: column appears more than once");
+
+            seen[static_cast<std::size_t>(column)] = stamp;
+        }
+
+        if (length == rows)
+            pop_row();
+
+        grid.scroll(1, 0);
+
+        auto const newest = static_cast<int>(rows) - 1;
+        for (; first != last; ++first) {
+            auto const column = static_cast<int>(first->first);
+            auto const value = static_cast<value_type>(first->second);
+
+            grid.set(newest, column, value);
+            column_sums[column] += value;
+            column_counts[column] += 1;
+            push(minima, minimum_queues[column], column, value, [](auto a, auto b) { return a <= b; });
+            push(maxima, maximum_queues[column], column, value, [](auto a, auto b) { return a >= b; });
+        }
+
+        ++steps;
+        ++length;
+    }
+
+    /// @brief Append a dense row, where `values` holds one value for each column.
+    /// @see `ds::sliding_window::push_row`
+
+    void push_row(value_type const* values) {
+        auto const cols = grid.dimensions().second;
+        dense_row.resize(cols);
+
+        for (auto column = std::size_t {0}; column < cols; ++column) {
+            dense_row[column] = {static_cast<int>(column), values[column]};
+        }
+
+        push_row(dense_row.begin(), dense_row.end());
+    }
+
+    /// @brief Drop the oldest row of the window, if any.
+    /// @note The amount of time required is proportional to cols.
+
+    void pop_row() {
+        if (length == 0)
+            return;
+
+        auto const [rows, cols] = grid.dimensions();
+        auto const oldest = static_cast<int>(rows - length);
+        auto const step = steps - length;
+
+        for (auto column = 0; column < static_cast<int>(cols); ++column) {
+            if (auto const value = grid.try_get(oldest, column)) {
+                column_sums[column] -= *value;
+                column_counts[column] -= 1;
+                grid.try_erase(oldest, column);
+            }
+
+            pop(minima, minimum_queues[column], column, step);
+            pop(maxima, maximum_queues[column], column, step);
+        }
+
+        --length;
+    }
+
+    /// @brief Get the number of rows in the window.
+
+    [[nodiscard]]
+    inline std::size_t size() const noexcept {
+        return length;
+    }
+
+    /// @brief Get the table of rows, where the newest row is the last row and the window holds the last `size()` rows.
+
+    [[nodiscard]]
+    inline table<value_type> const& contents() const noexcept {
+        return grid;
+    }
+
+public:
+    /// @brief Get the sum of the given column over the window.
+
+    [[nodiscard]]
+    inline value_type sum(int const column) const noexcept {
+        return column_sums[column];
+    }
+
+    /// @brief Get the number of occupied cells of the given column in the window.
+
+    [[nodiscard]]
+    inline int count(int const column) const noexcept {
+        return column_counts[column];
+    }
+
+    /// @brief Get the mean of the occupied cells of the given column in the window, or zero if there are none.
+
+    [[nodiscard]]
+    inline double mean(int const column) const noexcept {
+        auto const n = column_counts[column];
+        return n == 0 ? 0.0 : static_cast<double>(column_sums[column]) / n;
+    }
+
+    /// @brief Get a pointer to the least value of the given column in the window, or `nullptr` if the column is empty.
+    /// @note The pointer is invalidated by the next push or pop.
+
+    [[nodiscard]]
+    inline value_type const* min(int const column) const noexcept {
+        return front(minima, minimum_queues[column], column);
+    }
+
+    /// @brief Get a pointer to the greatest value of the given column in the window, or `nullptr` if the column is empty.
+    /// @note The pointer is invalidated by the next push or pop.
+
+    [[nodiscard]]
+    inline value_type const* max(int const column) const noexcept {
+        return front(maxima, maximum_queues[column], column);
+    }
+
+    /// @brief Get a pointer to the sums of every column, which is contiguous and has one element per column.
+
+    [[nodiscard]]
+    inline value_type const* sums() const noexcept {
+        return column_sums.data();
+    }
+
+    /// @brief Write the mean of every column to the given array, which must have one element per column.
+    /// @note This is a branch-free loop over contiguous arrays that the compiler can vectorise.
+
+    void means(double* output) const noexcept {
+        auto const cols = column_sums.size();
+        for (auto column = std::size_t {0}; column < cols; ++column) {
+            auto const n = static_cast<double>(column_counts[column]);
+            output[column] = static_cast<double>(column_sums[column]) / (n > 0.0 ? n : 1.0);
+        }
+    }
+
+private:
+    /// @brief Push a value onto the back of the given monotonic queue, removing each entry that it dominates.
+
+    template<typename order_function>
+    inline void push(std::vector<entry>& entries, queue& q, int const column, value_type const value, order_function&& precedes) {
+        auto const capacity = grid.dimensions().first;
+        auto const base = static_cast<std::size_t>(column) * capacity;
+
+        while (q.size > 0 && !precedes(entries[base + (q.head + q.size - 1) % capacity].value, value)) {
+            --q.size;
+        }
+
+        entries[base + (q.head + q.size) % capacity] = {steps, value};
+        ++q.size;
+    }
+
+    /// @brief Pop the front of the given monotonic queue if it belongs to the given step.
+
+    inline void pop(std::vector<entry>& entries, queue& q, int const column, std::uint64_t const step) {
+        auto const capacity = grid.dimensions().first;
+        if (q.size > 0 && entries[static_cast<std::size_t>(column) * capacity + q.head].step == step) {
+            q.head = (q.head + 1) % capacity;
+            --q.size;
+        }
+    }
+
+    [[nodiscard]]
+    inline value_type const* front(std::vector<entry> const& entries, queue const& q, int const column) const noexcept {
+        auto const capacity = grid.dimensions().first;
+        return q.size == 0 ? nullptr : &entries[static_cast<std::size_t>(column) * capacity + q.head].value;
+    }
+
+private:
+    table<value_type> grid;
+
+    std::vector<value_type> column_sums;
+    std::vector<int> column_counts;
+
+    std::vector<entry> minima;
+    std::vector<entry> maxima;
+    std::vector<queue> minimum_queues;
+    std::vector<queue> maximum_queues;
+    std::vector<std::pair<int, value_type>> dense_row;
+
+    /// @brief The call to `push_row` in which each column was last seen, which detects repeated columns without clearing.
+
+    std::vector<std::uint64_t> seen;
+    std::uint64_t validations {0};
+
+    std::uint64_t steps {0};
+    std::size_t length {0};
+};
+
+}
+
+#endif
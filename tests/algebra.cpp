@@ -0,0 +1,104 @@
+//! @file algebra.cpp
+//! @date 17/10/26
+//! @brief Tests for the set algebra of the occupied cells of tables.
+//! @author David Spry
+
+#include <random>
+#include <stdexcept>
+#include <gtest/gtest.h>
+
+#include "../include/table/algebra.hpp"
+
+namespace {
+ds::table<int> random_table(std::size_t const rows, std::size_t const cols, unsigned const seed) {
+    ds::table<int> table(rows, cols);
+    std::mt19937 mersenne(seed);
+    std::bernoulli_distribution occupied(0.4);
+    std::uniform_int_distribution<int> value(1, 100);
+
+    for (auto row = 0; row < static_cast<int>(rows); ++row) {
+        for (auto col = 0; col < static_cast<int>(cols); ++col) {
+            if (occupied(mersenne))
+                table.emplace(row, col, value(mersenne));
+        }
+    }
+
+    return table;
+}
+}
+
+TEST(SetAlgebra, AgainstCellwise) {
+    std::size_t const rows = 13;
+    std::size_t const cols = 131;
+
+    auto a = random_table(rows, cols, 1);
+    auto b = random_table(rows, cols, 2);
+    a.scroll(3, 70);
+    b.scroll(-1, 5);
+
+    ds::table<int> both;
+    ds::table<int, ds::row_index> either;
+    ds::table<int> difference(rows, cols);
+    difference.set(0, 0, -1);
+
+    ds::set_algebra algebra;
+    algebra.intersect(a, b, both, [](int x, int y) { return x * 1000 + y; });
+    algebra.unite(a, b, either, [](int x, int y) { return x - y; });
+    algebra.subtract(a, b, difference);
+
+    EXPECT_EQ(both.dimensions(), a.dimensions());
+    EXPECT_EQ(either.dimensions(), a.dimensions());
+
+    for (auto row = 0; row < static_cast<int>(rows); ++row) {
+        for (auto col = 0; col < static_cast<int>(cols); ++col) {
+            auto const x = a.get(row, col);
+            auto const y = b.get(row, col);
+
+            auto const intersection = both.get(row, col);
+            ASSERT_EQ(intersection != nullptr, x && y);
+            if (intersection) {
+                EXPECT_EQ(*intersection, *x * 1000 + *y);
+            }
+
+            auto const u = either.get(row, col);
+            ASSERT_EQ(u != nullptr, x || y);
+            if (u) {
+                EXPECT_EQ(*u, x && y ? *x - *y : x ? *x : *y);
+            }
+
+            auto const d = difference.get(row, col);
+            ASSERT_EQ(d != nullptr, x && !y);
+            if (d) {
+                EXPECT_EQ(*d, *x);
+            }
+        }
+    }
+}
+
+TEST(SetAlgebra, FreeFunctions) {
+    ds::table<int> a(2, 2);
+    ds::table<int> b(2, 2);
+    ds::table<int> target;
+
+    a.set(0, 0, 1);
+    a.set(0, 1, 2);
+    b.set(0, 1, 3);
+    b.set(1, 1, 4);
+
+    ds::intersect(a, b, target);
+    EXPECT_EQ(target.count(), 1);
+    EXPECT_EQ(target.at(0, 1), 2);
+
+    ds::unite(a, b, target);
+    EXPECT_EQ(target.count(), 3);
+    EXPECT_EQ(target.at(0, 1), 2);
+    EXPECT_EQ(target.at(1, 1), 4);
+
+    ds::subtract(a, b, target);
+    EXPECT_EQ(target.count(), 1);
+    EXPECT_EQ(target.at(0, 0), 1);
+
+    ds::table<int> other(3, 2);
+    EXPECT_THROW(ds::subtract(a, other, target), std::invalid_argument);
+    EXPECT_THROW(ds::subtract(a, b, a), std::invalid_argument);
+}
@@ -0,0 +1,109 @@
+//! @file automaton.cpp
+//! @date 17/10/26
+//! @brief Tests for the sparse cellular automaton stepper.
+//! @author David Spry
+
+#include <random>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "../include/table/automaton.hpp"
+
+namespace {
+std::vector<bool> dense_step(std::vector<bool> const& cells, int const rows, int const cols) {
+    std::vector<bool> next(cells.size(), false);
+
+    for (auto y = 0; y < rows; ++y) {
+        for (auto x = 0; x < cols; ++x) {
+            auto n = 0;
+            for (auto dy = -1; dy <= 1; ++dy) {
+                for (auto dx = -1; dx <= 1; ++dx) {
+                    auto const ny = y + dy;
+                    auto const nx = x + dx;
+                    if ((dy || dx) && ny >= 0 && nx >= 0 && ny < rows && nx < cols)
+                        n += cells[ny * cols + nx];
+                }
+            }
+
+            next[y * cols + x] = ds::life_rule::conway()(cells[y * cols + x], n);
+        }
+    }
+
+    return next;
+}
+}
+
+TEST(Automaton, Blinker) {
+    ds::table<int> table(5, 5);
+    table.emplace(2, 1, 0);
+    table.emplace(2, 2, 0);
+    table.emplace(2, 3, 0);
+
+    ds::automaton automaton;
+    auto const [births, deaths] = automaton.step(table, ds::life_rule::conway(), [](int row, int col) {
+        return row * 10 + col;
+    });
+
+    EXPECT_EQ(births, 2);
+    EXPECT_EQ(deaths, 2);
+    EXPECT_EQ(table.count(), 3);
+    EXPECT_EQ(table.at(1, 2), 12);
+    EXPECT_EQ(table.at(2, 2), 0);
+    EXPECT_EQ(table.at(3, 2), 32);
+
+    automaton.step(table, ds::life_rule::conway());
+    EXPECT_TRUE(table.contains(2, 1));
+    EXPECT_TRUE(table.contains(2, 3));
+    EXPECT_FALSE(table.contains(1, 2));
+
+    EXPECT_THROW(automaton.step(table, ds::life_rule {0b1001, 0b1100}), std::invalid_argument);
+    EXPECT_EQ(table.count(), 3);
+}
+
+TEST(Automaton, ToroidalGlider) {
+    ds::table<int> table(6, 6);
+
+    for (auto [row, col]: {std::pair {0, 1}, {1, 2}, {2, 0}, {2, 1}, {2, 2}}) {
+        table.emplace(row, col, 1);
+    }
+
+    ds::automaton automaton;
+    automaton.toroidal = true;
+
+    for (auto generation = 0; generation < 24; ++generation) {
+        automaton.step(table, ds::life_rule::conway());
+        EXPECT_EQ(table.count(), 5);
+    }
+
+    for (auto [row, col]: {std::pair {0, 1}, {1, 2}, {2, 0}, {2, 1}, {2, 2}}) {
+        EXPECT_TRUE(table.contains(row, col));
+    }
+}
+
+TEST(Automaton, MatchesDenseStep) {
+    auto constexpr rows = 32;
+    auto constexpr cols = 27;
+
+    std::mt19937 mersenne(5);
+    std::bernoulli_distribution alive(0.3);
+    std::vector<bool> cells(rows * cols);
+    ds::table<char> table(rows, cols);
+    table.scroll(5, 7);
+
+    for (auto t = 0; t < rows * cols; ++t) {
+        cells[t] = alive(mersenne);
+        if (cells[t])
+            table.emplace(t / cols, t % cols, 'x');
+    }
+
+    ds::automaton automaton;
+
+    for (auto generation = 0; generation < 20; ++generation) {
+        cells = dense_step(cells, rows, cols);
+        automaton.step(table, ds::life_rule::conway());
+
+        for (auto t = 0; t < rows * cols; ++t) {
+            ASSERT_EQ(table.contains(t / cols, t % cols), cells[t]);
+        }
+    }
+}
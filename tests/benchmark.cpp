@@ -3,10 +3,20 @@
 //! @brief Benchmarking for the `ds::table<T>` type.
 //! @author David Spry
 
+#include <chrono>
 #include <random>
+#include <numeric>
+#include <algorithm>
+#include <sstream>
 #include <benchmark/benchmark.h>
 
 #include "../include/table.hpp"
+#include "../include/table/automaton.hpp"
+#include "../include/table/serialize.hpp"
+#include "../include/table/algebra.hpp"
+#include "../include/table/multi_table.hpp"
+#include "../include/table/palette_table.hpp"
+#include "../include/table/bit_table.hpp"
 
 auto static constexpr Rows {10};
 auto static constexpr Cols {10};
@@ -118,4 +128,474 @@ BENCHMARK_TEMPLATE_F(TableFixture, BM_SetSize, int)(benchmark::State& state) {
     }
 }
 
+template<typename T>
+static void BM_RowMajorIteration(benchmark::State& state) {
+    auto const size = static_cast<std::size_t>(state.range(0));
+    T table(size, size);
+    std::mt19937 mersenne(1);
+    std::bernoulli_distribution occupied(0.01);
+
+    for (auto row = 0; row < size; ++row) {
+        for (auto col = 0; col < size; ++col) {
+            if (occupied(mersenne))
+                table.emplace(row, col, row + col);
+        }
+    }
+
+    for (auto _: state) {
+        auto sum = 0;
+        table.for_each_in_row_major_order([&](int, int, int value) { sum += value; });
+        benchmark::DoNotOptimize(sum);
+    }
+}
+
+BENCHMARK_TEMPLATE(BM_RowMajorIteration, ds::table<int>)->Arg(1024);
+BENCHMARK_TEMPLATE(BM_RowMajorIteration, ds::table<int, ds::row_index>)->Arg(1024);
+
+static void BM_ColumnScanByRowGets(benchmark::State& state) {
+    auto const size = static_cast<std::size_t>(state.range(0));
+    ds::table<int> table(size, size);
+    std::mt19937 mersenne(1);
+    std::bernoulli_distribution occupied(0.05);
+
+    for (auto row = 0; row < size; ++row) {
+        for (auto col = 0; col < size; ++col) {
+            if (occupied(mersenne))
+                table.emplace(row, col, row + col);
+        }
+    }
+
+    auto column = 0;
+    for (auto _: state) {
+        auto sum = 0;
+        for (auto row = 0; row < size; ++row) {
+            if (auto const value = table.get(row, column))
+                sum += *value;
+        }
+
+        column = (column + 1) % static_cast<int>(size);
+        benchmark::DoNotOptimize(sum);
+    }
+}
+
+template<typename T>
+static void BM_ColumnScan(benchmark::State& state) {
+    auto const size = static_cast<std::size_t>(state.range(0));
+    T table(size, size);
+    std::mt19937 mersenne(1);
+    std::bernoulli_distribution occupied(0.05);
+
+    for (auto row = 0; row < size; ++row) {
+        for (auto col = 0; col < size; ++col) {
+            if (occupied(mersenne))
+                table.emplace(row, col, row + col);
+        }
+    }
+
+    auto column = 0;
+    for (auto _: state) {
+        auto sum = 0;
+        table.for_each_in_column(column, [&](int, int value) { sum += value; });
+
+        column = (column + 1) % static_cast<int>(size);
+        benchmark::DoNotOptimize(sum);
+    }
+}
+
+BENCHMARK(BM_ColumnScanByRowGets)->Arg(1024)->Arg(4096);
+BENCHMARK_TEMPLATE(BM_ColumnScan, ds::table<int>)->Arg(1024)->Arg(4096);
+BENCHMARK_TEMPLATE(BM_ColumnScan, ds::table<int, ds::column_index>)->Arg(1024)->Arg(4096);
+
+static void BM_AutomatonStep(benchmark::State& state) {
+    auto const size = static_cast<std::size_t>(state.range(0));
+    ds::table<int> table(size, size);
+
+    for (auto row = 1; row < size; row += 16) {
+        for (auto col = 1; col + 2 < size; col += 16) {
+            table.emplace(row, col, 1);
+            table.emplace(row, col + 1, 1);
+            table.emplace(row, col + 2, 1);
+        }
+    }
+
+    ds::automaton automaton;
+    automaton.toroidal = true;
+
+    for (auto _: state) {
+        automaton.step(table, ds::life_rule::conway());
+    }
+}
+
+BENCHMARK(BM_AutomatonStep)->Arg(256)->Arg(1024);
+
+static void BM_RealTimeSetErase(benchmark::State& state) {
+    using clock = std::chrono::steady_clock;
+
+    auto constexpr size = 64;
+    ds::table<int, ds::occupancy_counts> table(size, size);
+    table.reserve(size * size);
+
+    std::mt19937 mersenne(1);
+    std::uniform_int_distribution<int> position(0, size - 1);
+    std::vector<std::pair<int, int>> positions(4096);
+    for (auto& [row, col]: positions) {
+        row = position(mersenne);
+        col = position(mersenne);
+    }
+
+    std::vector<clock::duration> latencies(positions.size());
+    auto worst = clock::duration::zero();
+
+    for (auto _: state) {
+        for (auto i = std::size_t {0}; i < positions.size(); ++i) {
+            auto const [row, col] = positions[i];
+            auto const start = clock::now();
+            if (table.try_erase(row, col) == ds::status::empty)
+                table.try_set(row, col, row + col);
+            latencies[i] = clock::now() - start;
+        }
+
+        worst = std::max(worst, *std::max_element(latencies.begin(), latencies.end()));
+    }
+
+    auto const percentile = latencies.begin() + static_cast<std::ptrdiff_t>(latencies.size() * 999 / 1000);
+    std::nth_element(latencies.begin(), percentile, latencies.end());
+
+    auto const nanoseconds = [](clock::duration d) {
+        return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(d).count());
+    };
+
+    state.SetItemsProcessed(state.iterations() * positions.size());
+    state.counters["p999_ns"] = nanoseconds(*percentile);
+    state.counters["worst_ns"] = nanoseconds(worst);
+}
+
+BENCHMARK(BM_RealTimeSetErase);
+
+static ds::table<int> sparse_board(std::size_t const size, double const density) {
+    ds::table<int> table(size, size);
+    std::mt19937 mersenne(1);
+    std::bernoulli_distribution occupied(density);
+
+    for (auto row = 0; row < size; ++row) {
+        for (auto col = 0; col < size; ++col) {
+            if (occupied(mersenne))
+                table.emplace(row, col, row ^ col);
+        }
+    }
+
+    return table;
+}
+
+static void BM_SaveRawDump(benchmark::State& state) {
+    auto const table = sparse_board(1024, 0.02);
+    auto bytes = std::size_t {0};
+
+    for (auto _: state) {
+        std::stringstream stream;
+        stream.write(reinterpret_cast<char const*>(table.lookup()), table.size() * sizeof(int));
+        stream.write(reinterpret_cast<char const*>(table.indices()), table.count() * sizeof(int));
+        stream.write(reinterpret_cast<char const*>(table.data()), table.count() * sizeof(int));
+        bytes = stream.str().size();
+    }
+
+    state.counters["bytes"] = static_cast<double>(bytes);
+}
+
+static void BM_SaveCompressed(benchmark::State& state) {
+    auto const table = sparse_board(1024, 0.02);
+    auto bytes = std::size_t {0};
+
+    for (auto _: state) {
+        std::stringstream stream;
+        ds::save(table, stream, ds::occupancy_encoding::automatic, ds::varint_codec<int> {});
+        bytes = stream.str().size();
+    }
+
+    state.counters["bytes"] = static_cast<double>(bytes);
+}
+
+static void BM_LoadCompressed(benchmark::State& state) {
+    std::stringstream stream;
+    ds::save(sparse_board(1024, 0.02), stream, ds::occupancy_encoding::automatic, ds::varint_codec<int> {});
+    auto const bytes = stream.str();
+
+    for (auto _: state) {
+        std::stringstream input(bytes);
+        benchmark::DoNotOptimize(ds::load<ds::table<int>>(input, ds::varint_codec<int> {}));
+    }
+}
+
+BENCHMARK(BM_SaveRawDump);
+BENCHMARK(BM_SaveCompressed);
+BENCHMARK(BM_LoadCompressed);
+
+static void BM_ScrollRebuild(benchmark::State& state) {
+    auto table = sparse_board(static_cast<std::size_t>(state.range(0)), 0.25);
+    auto const [rows, cols] = table.dimensions();
+
+    for (auto _: state) {
+        ds::table<int> scrolled(rows, cols);
+        for (auto const& [row, col, value]: table.occupied()) {
+            if (row > 0)
+                scrolled.emplace(row - 1, col, value);
+        }
+
+        for (auto col = 0; col < static_cast<int>(cols); ++col) {
+            scrolled.emplace(static_cast<int>(rows) - 1, col, col);
+        }
+
+        table = std::move(scrolled);
+    }
+}
+
+static void BM_Scroll(benchmark::State& state) {
+    auto table = sparse_board(static_cast<std::size_t>(state.range(0)), 0.25);
+    auto const [rows, cols] = table.dimensions();
+
+    for (auto _: state) {
+        table.scroll(1, 0);
+
+        for (auto col = 0; col < static_cast<int>(cols); ++col) {
+            table.emplace(static_cast<int>(rows) - 1, col, col);
+        }
+    }
+}
+
+BENCHMARK(BM_ScrollRebuild)->Arg(256)->Arg(1024);
+BENCHMARK(BM_Scroll)->Arg(256)->Arg(1024);
+
+static void BM_CopyRegionPerCell(benchmark::State& state) {
+    auto const source = sparse_board(512, static_cast<double>(state.range(0)) / 100.0);
+    ds::table<int> target(512, 512);
+
+    for (auto _: state) {
+        target.reset();
+        for (auto row = 0; row < 512; ++row) {
+            for (auto col = 0; col < 512; ++col) {
+                if (auto const value = source.get(row, col))
+                    target.set(row, col, *value);
+            }
+        }
+    }
+}
+
+static void BM_Blit(benchmark::State& state) {
+    auto const source = sparse_board(512, static_cast<double>(state.range(0)) / 100.0);
+    ds::table<int> target(512, 512);
+
+    for (auto _: state) {
+        target.reset();
+        target.blit(source, {0, 0, 512, 512}, 0, 0);
+    }
+}
+
+BENCHMARK(BM_CopyRegionPerCell)->Arg(5)->Arg(100);
+BENCHMARK(BM_Blit)->Arg(5)->Arg(100);
+
+static void BM_IntersectCellwise(benchmark::State& state) {
+    auto const a = sparse_board(1024, 0.3);
+    auto b = sparse_board(1024, 0.0);
+    b.blit(a, {0, 0, 1024, 1024}, 1, 0);
+    ds::table<int> target(1024, 1024);
+
+    for (auto _: state) {
+        target.reset();
+        for (auto row = 0; row < 1024; ++row) {
+            for (auto col = 0; col < 1024; ++col) {
+                if (a.contains(row, col) && b.contains(row, col))
+                    target.set(row, col, a.at(row, col));
+            }
+        }
+    }
+}
+
+static void BM_Intersect(benchmark::State& state) {
+    auto const a = sparse_board(1024, 0.3);
+    auto b = sparse_board(1024, 0.0);
+    b.blit(a, {0, 0, 1024, 1024}, 1, 0);
+    ds::table<int> target(1024, 1024);
+    ds::set_algebra algebra;
+
+    for (auto _: state) {
+        algebra.intersect(a, b, target, [](int x, int) { return x; });
+    }
+}
+
+BENCHMARK(BM_IntersectCellwise);
+BENCHMARK(BM_Intersect);
+
+static std::vector<std::pair<int, int>> entity_positions(std::size_t const count, int const size) {
+    std::mt19937 mersenne(1);
+    std::uniform_int_distribution<int> position(0, size - 1);
+    std::vector<std::pair<int, int>> positions(count);
+
+    for (auto& [row, col]: positions) {
+        row = position(mersenne);
+        col = position(mersenne);
+    }
+
+    return positions;
+}
+
+static void BM_NestedVectorRebuild(benchmark::State& state) {
+    auto const positions = entity_positions(static_cast<std::size_t>(state.range(0)), 128);
+    ds::table<std::vector<int>> table(128, 128);
+
+    for (auto _: state) {
+        table.reset();
+        for (auto i = 0; i < static_cast<int>(positions.size()); ++i) {
+            auto const [row, col] = positions[i];
+            if (auto const cell = table.get(row, col))
+                cell->push_back(i);
+            else
+                table.set(row, col, {i});
+        }
+    }
+}
+
+static void BM_MultiTableRebuild(benchmark::State& state) {
+    auto const positions = entity_positions(static_cast<std::size_t>(state.range(0)), 128);
+    ds::multi_table<int> table(128, 128);
+
+    for (auto _: state) {
+        table.rebuild();
+        for (auto i = 0; i < static_cast<int>(positions.size()); ++i) {
+            table.insert(positions[i].first, positions[i].second, i);
+        }
+    }
+}
+
+BENCHMARK(BM_NestedVectorRebuild)->Arg(10000)->Arg(100000);
+BENCHMARK(BM_MultiTableRebuild)->Arg(10000)->Arg(100000);
+
+static ds::table<int> const& large_board() {
+    static auto const table = [] {
+        auto constexpr size = 8192;
+        ds::table<int> table(size, size);
+        std::vector<int> order(size * size);
+        std::iota(order.begin(), order.end(), 0);
+        std::shuffle(order.begin(), order.end(), std::mt19937(1));
+
+        table.reserve(order.size() / 8);
+        for (auto k = std::size_t {0}; k < order.size() / 8; ++k) {
+            table.emplace(order[k] / size, order[k] % size, order[k]);
+        }
+
+        return table;
+    }();
+
+    return table;
+}
+
+static void BM_GetLoop(benchmark::State& state) {
+    auto const& table = large_board();
+    auto const positions = entity_positions(1 << 20, 8192);
+    std::vector<int const*> results(10000);
+    auto offset = std::size_t {0};
+
+    for (auto _: state) {
+        auto const batch = positions.data() + offset;
+        for (auto k = std::size_t {0}; k < results.size(); ++k) {
+            results[k] = table.try_get(batch[k].first, batch[k].second);
+        }
+
+        offset = (offset + results.size()) % (positions.size() - results.size());
+        benchmark::DoNotOptimize(results.data());
+    }
+}
+
+static void BM_GetMany(benchmark::State& state) {
+    auto const& table = large_board();
+    auto const positions = entity_positions(1 << 20, 8192);
+    std::vector<int const*> results(10000);
+    auto offset = std::size_t {0};
+
+    for (auto _: state) {
+        table.get_many(positions.data() + offset, results.size(), results.data());
+        offset = (offset + results.size()) % (positions.size() - results.size());
+        benchmark::DoNotOptimize(results.data());
+    }
+}
+
+BENCHMARK(BM_GetLoop);
+BENCHMARK(BM_GetMany);
+
+template<typename grid>
+static void fill_terrain(grid& table, int const size) {
+    std::mt19937 generator(11);
+    std::uniform_int_distribution<int> kinds(0, 19);
+    for (auto row = 0; row < size; ++row) {
+        for (auto col = 0; col < size; ++col) {
+            table.set(row, col, 100 + kinds(generator));
+        }
+    }
+}
+
+static void BM_FilterTable(benchmark::State& state) {
+    ds::table<int> table(2048, 2048);
+    fill_terrain(table, 2048);
+
+    for (auto _: state) {
+        auto const n = std::count(table.data(), table.data() + table.count(), 107);
+        benchmark::DoNotOptimize(n);
+    }
+
+    state.counters["bytes"] = static_cast<double>(2048 * 2048 * sizeof(int) + table.count() * (sizeof(int) + sizeof(int)));
+}
+
+static void BM_FilterPalette(benchmark::State& state) {
+    ds::palette_table<int> table(2048, 2048);
+    fill_terrain(table, 2048);
+
+    for (auto _: state) {
+        auto const n = table.count(107);
+        benchmark::DoNotOptimize(n);
+    }
+
+    state.counters["bytes"] = static_cast<double>(2048 * 2048 * table.bits() / 8);
+}
+
+BENCHMARK(BM_FilterTable);
+BENCHMARK(BM_FilterPalette);
+
+template<typename grid>
+static void fill_mask(grid& table, int const size) {
+    std::mt19937 generator(13);
+    std::bernoulli_distribution occupied(0.3);
+    for (auto row = 0; row < size; ++row) {
+        for (auto col = 0; col < size; ++col) {
+            if (occupied(generator))
+                table.set(row, col, 1);
+        }
+    }
+}
+
+static void BM_ScrollMaskTable(benchmark::State& state) {
+    ds::table<char> table(1024, 1024);
+    fill_mask(table, 1024);
+
+    for (auto _: state) {
+        table.scroll(1, 1);
+        benchmark::ClobberMemory();
+    }
+
+    state.counters["bytes"] = static_cast<double>(1024 * 1024 * sizeof(int) + table.count() * (sizeof(int) + sizeof(char)));
+}
+
+static void BM_ScrollMaskBits(benchmark::State& state) {
+    ds::bit_table table(1024, 1024);
+    fill_mask(table, 1024);
+
+    for (auto _: state) {
+        table.scroll(1, 1);
+        benchmark::ClobberMemory();
+    }
+
+    state.counters["bytes"] = static_cast<double>(1024 * table.words_per_row() * sizeof(std::uint64_t));
+}
+
+BENCHMARK(BM_ScrollMaskTable);
+BENCHMARK(BM_ScrollMaskBits);
+
 BENCHMARK_MAIN();
\ No newline at end of file
@@ -0,0 +1,87 @@
+//! @file bit_table.cpp
+//! @date 17/10/26
+//! @brief Tests for the bit-packed table of flags.
+//! @author David Spry
+
+#include <random>
+#include <gtest/gtest.h>
+
+#include "../include/table/bit_table.hpp"
+
+namespace {
+
+void expect_same(ds::bit_table const& bits, ds::table<char> const& expected) {
+    auto const [rows, cols] = expected.dimensions();
+    ASSERT_EQ(bits.count(), expected.count());
+    for (auto row = 0; row < static_cast<int>(rows); ++row) {
+        for (auto col = 0; col < static_cast<int>(cols); ++col) {
+            ASSERT_EQ(bits.contains(row, col), expected.contains(row, col)) << row << ", " << col;
+        }
+    }
+}
+
+}
+
+TEST(BitTable, SetAndSearch) {
+    ds::bit_table table(5, 130);
+    EXPECT_EQ(table.words_per_row(), 3);
+    EXPECT_FALSE(table.any());
+    EXPECT_EQ(table.count(), 0);
+    EXPECT_FALSE(table.find_next(0, 0).has_value());
+
+    table.set(0, 3);
+    table.set(2, 129);
+    table.set(4, 64);
+    table.set(4, 64);
+    EXPECT_TRUE(table.any());
+    EXPECT_EQ(table.count(), 3);
+    EXPECT_TRUE(table.contains(2, 129));
+
+    EXPECT_EQ(table.find_next(0, 0), std::make_pair(0, 3));
+    EXPECT_EQ(table.find_next(0, 3), std::make_pair(0, 3));
+    EXPECT_EQ(table.find_next(0, 4), std::make_pair(2, 129));
+    EXPECT_EQ(table.find_next(3, 0), std::make_pair(4, 64));
+    EXPECT_FALSE(table.find_next(4, 65).has_value());
+
+    std::vector<std::pair<int, int>> cells;
+    table.for_each([&](int row, int col) { cells.emplace_back(row, col); });
+    EXPECT_EQ(cells, (std::vector<std::pair<int, int>> {{0, 3}, {2, 129}, {4, 64}}));
+
+    table.erase(2, 129);
+    table.set(0, 3, false);
+    EXPECT_EQ(table.count(), 1);
+
+    EXPECT_THROW(table.set(5, 0), std::out_of_range);
+    EXPECT_THROW(static_cast<void>(table.contains(0, 130)), std::out_of_range);
+
+    table.reset();
+    EXPECT_FALSE(table.any());
+}
+
+TEST(BitTable, ScrollMatchesTable) {
+    constexpr auto rows = 23;
+    constexpr auto cols = 200;
+
+    std::mt19937 generator(5);
+    std::bernoulli_distribution occupied(0.4);
+
+    for (auto const& [dy, dx]: std::vector<std::pair<int, int>> {{0, 1}, {0, -1}, {1, 0}, {-3, 0}, {2, 64}, {-1, -64},
+                                                                 {5, 70}, {-7, -130}, {0, 199}, {22, -199}, {23, 0}, {0, -200}}) {
+        ds::bit_table bits(rows, cols);
+        ds::table<char> expected(rows, cols);
+
+        for (auto row = 0; row < rows; ++row) {
+            for (auto col = 0; col < cols; ++col) {
+                if (occupied(generator)) {
+                    bits.set(row, col);
+                    expected.set(row, col, 1);
+                }
+            }
+        }
+
+        bits.scroll(dy, dx);
+        expected.scroll(dy, dx);
+        expected.normalise();
+        expect_same(bits, expected);
+    }
+}
@@ -0,0 +1,130 @@
+//! @file components.cpp
+//! @date 17/10/26
+//! @brief Tests for flood fill and connected-component labelling.
+//! @author David Spry
+
+#include <random>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "../include/table/components.hpp"
+
+namespace {
+ds::table<int> random_table(std::size_t const rows, std::size_t const cols, double const density) {
+    ds::table<int> table(rows, cols);
+    std::mt19937 mersenne(rows * 31 + cols);
+    std::bernoulli_distribution occupied(density);
+
+    for (auto row = 0; row < static_cast<int>(rows); ++row) {
+        for (auto col = 0; col < static_cast<int>(cols); ++col) {
+            if (occupied(mersenne))
+                table.emplace(row, col, row + col);
+        }
+    }
+
+    return table;
+}
+}
+
+TEST(Components, FloodFill) {
+    ds::table<int> table(4, 5);
+
+    //  | x | x | _ | _ | x |
+    //  | _ | x | _ | x | x |
+    //  | _ | x | _ | _ | _ |
+    //  | _ | _ | x | x | _ |
+
+    for (auto [row, col]: {std::pair {0, 0}, {0, 1}, {1, 1}, {2, 1}, {0, 4}, {1, 3}, {1, 4}, {3, 2}, {3, 3}}) {
+        table.emplace(row, col, 1);
+    }
+
+    ds::table<char> fill;
+    EXPECT_EQ(ds::flood_fill(table, 0, 0, fill, 'a'), 4);
+    EXPECT_EQ(fill.dimensions(), table.dimensions());
+    EXPECT_EQ(fill.count(), 4);
+    EXPECT_EQ(fill.at(2, 1), 'a');
+    EXPECT_FALSE(fill.contains(3, 2));
+
+    EXPECT_EQ(ds::flood_fill(table, 0, 2, fill, 'b'), 0);
+    EXPECT_EQ(ds::flood_fill(table, 9, 9, fill, 'b'), 0);
+
+    EXPECT_EQ(ds::flood_fill(table, 1, 4, fill, 'c'), 3);
+    EXPECT_EQ(ds::flood_fill(table, 0, 0, fill, 'd', ds::connectivity::eight), 6);
+    EXPECT_EQ(fill.at(3, 3), 'd');
+    EXPECT_EQ(fill.at(0, 4), 'c');
+
+    table.scroll(0, 1);
+    EXPECT_EQ(ds::flood_fill(table, 0, 0, fill, 'e'), 3);
+    EXPECT_EQ(fill.at(2, 0), 'e');
+    EXPECT_FALSE(fill.contains(0, 3));
+
+    ds::table<int> labels;
+    EXPECT_EQ(ds::label_components(table, labels), 3);
+    EXPECT_EQ(labels.at(2, 0), labels.at(0, 0));
+    EXPECT_EQ(labels.at(1, 2), labels.at(0, 3));
+    EXPECT_NE(labels.at(3, 1), labels.at(0, 0));
+    EXPECT_FALSE(labels.contains(0, 4));
+}
+
+TEST(Components, LabelComponents) {
+    ds::table<int> table(3, 4);
+
+    //  | x | _ | x | _ |
+    //  | _ | x | x | _ |
+    //  | x | _ | _ | x |
+
+    for (auto [row, col]: {std::pair {0, 0}, {0, 2}, {1, 1}, {1, 2}, {2, 0}, {2, 3}}) {
+        table.emplace(row, col, 1);
+    }
+
+    ds::table<int> labels;
+    EXPECT_EQ(ds::label_components(table, labels), 4);
+    EXPECT_EQ(labels.count(), table.count());
+    EXPECT_EQ(labels.at(0, 0), 1);
+    EXPECT_EQ(labels.at(0, 2), 2);
+    EXPECT_EQ(labels.at(1, 1), 2);
+    EXPECT_EQ(labels.at(2, 0), 3);
+    EXPECT_EQ(labels.at(2, 3), 4);
+
+    EXPECT_EQ(ds::label_components(table, labels, ds::connectivity::eight), 1);
+    EXPECT_EQ(labels.count(), table.count());
+    EXPECT_EQ(labels.at(2, 3), 1);
+}
+
+TEST(Components, LabelComponentsMatchesFloodFill) {
+    ds::labeller labeller;
+
+    for (auto const neighbourhood: {ds::connectivity::four, ds::connectivity::eight}) {
+        auto const table = random_table(61, 47, 0.45);
+
+        ds::table<int> labels;
+        auto const n = labeller.label_components(table, labels, neighbourhood);
+
+        std::vector<std::size_t> sizes(n + 1, 0);
+        for (auto const label: labels) {
+            sizes.at(label) += 1;
+        }
+
+        ds::table<int> fill;
+        for (auto row = 0; row < 61; ++row) {
+            for (auto col = 0; col < 47; ++col) {
+                if (!table.contains(row, col))
+                    continue;
+
+                auto const label = labels.at(row, col);
+                EXPECT_EQ(labeller.flood_fill(table, row, col, fill, label, neighbourhood), sizes.at(label));
+            }
+        }
+
+        for (auto const threads: {2, 3, 8, 100}) {
+            ds::table<int> tiled;
+            ASSERT_EQ(labeller.label_components(table, tiled, neighbourhood, threads), n);
+
+            for (auto row = 0; row < 61; ++row) {
+                for (auto col = 0; col < 47; ++col) {
+                    EXPECT_EQ(tiled.at_else(row, col, 0), labels.at_else(row, col, 0));
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,117 @@
+//! @file convolution.cpp
+//! @date 17/10/26
+//! @brief Tests for separable convolution and box filters over a table.
+//! @author David Spry
+
+#include <random>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "../include/table/convolution.hpp"
+
+namespace {
+void expect_convolved(ds::table<float> const& source, ds::table<float> const& target,
+                      std::vector<float> const& horizontal, std::vector<float> const& vertical) {
+    auto const [rows, cols] = source.dimensions();
+    auto const rx = static_cast<int>(horizontal.size() / 2);
+    auto const ry = static_cast<int>(vertical.size() / 2);
+
+    ASSERT_EQ(target.dimensions(), source.dimensions());
+
+    for (auto y = 0; y < static_cast<int>(rows); ++y) {
+        for (auto x = 0; x < static_cast<int>(cols); ++x) {
+            auto sum = 0.0f;
+            auto reached = false;
+
+            for (auto j = -ry; j <= ry; ++j) {
+                for (auto i = -rx; i <= rx; ++i) {
+                    if (y + j < 0 || x + i < 0 || y + j >= static_cast<int>(rows) || x + i >= static_cast<int>(cols))
+                        continue;
+
+                    if (auto const cell = source.get(y + j, x + i)) {
+                        sum += vertical[ry - j] * horizontal[rx - i] * *cell;
+                        reached = true;
+                    }
+                }
+            }
+
+            ASSERT_EQ(target.contains(y, x), reached);
+            if (reached) {
+                EXPECT_NEAR(target.at(y, x), sum, 1e-4f);
+            }
+        }
+    }
+}
+}
+
+TEST(Convolution, SingleImpulse) {
+    ds::table<float> source(5, 5);
+    source.emplace(2, 2, 1.0f);
+
+    ds::table<float> target;
+    ds::convolve(source, target, std::vector {1.0f, 2.0f, 3.0f}, std::vector {4.0f, 5.0f, 6.0f});
+
+    EXPECT_EQ(target.count(), 9);
+    EXPECT_FLOAT_EQ(target.at(1, 1), 4.0f * 1.0f);
+    EXPECT_FLOAT_EQ(target.at(2, 2), 5.0f * 2.0f);
+    EXPECT_FLOAT_EQ(target.at(3, 3), 6.0f * 3.0f);
+    EXPECT_FLOAT_EQ(target.at(1, 3), 4.0f * 3.0f);
+    EXPECT_FALSE(target.contains(0, 0));
+
+    EXPECT_THROW(ds::convolve(source, source, std::vector {1.0f}, std::vector {1.0f}), std::invalid_argument);
+    EXPECT_THROW(ds::convolve(source, target, std::vector {1.0f, 2.0f}, std::vector {1.0f}), std::invalid_argument);
+    EXPECT_THROW(ds::convolve(source, target, std::vector {1.0f}, std::vector<float> {}), std::invalid_argument);
+}
+
+TEST(Convolution, BoxFilter) {
+    ds::table<float> source(4, 4);
+    for (auto row = 0; row < 4; ++row) {
+        for (auto col = 0; col < 4; ++col) {
+            source.emplace(row, col, 9.0f);
+        }
+    }
+
+    ds::table<float> target;
+    ds::box_filter<float>(source, target, 1);
+
+    EXPECT_EQ(target.count(), 16);
+    EXPECT_NEAR(target.at(1, 1), 9.0f, 1e-5f);
+    EXPECT_NEAR(target.at(0, 0), 4.0f, 1e-5f);
+    EXPECT_NEAR(target.at(0, 1), 6.0f, 1e-5f);
+
+    EXPECT_THROW(ds::box_filter<float>(source, target, -1), std::invalid_argument);
+}
+
+TEST(Convolution, DenseAndSparseRowsAgree) {
+    std::mt19937 mersenne(3);
+    std::uniform_real_distribution<float> value(-1.0f, 1.0f);
+
+    std::vector<float> const gradient {-1.0f, 0.0f, 1.0f};
+    std::vector<float> const smooth {0.1f, 0.2f, 0.4f, 0.2f, 0.1f};
+
+    for (auto const fill: {0.02, 0.3, 0.95}) {
+        ds::table<float> source(23, 31);
+        std::bernoulli_distribution occupied(fill);
+        source.scroll(4, 9);
+
+        for (auto row = 0; row < 23; ++row) {
+            for (auto col = 0; col < 31; ++col) {
+                if (occupied(mersenne))
+                    source.emplace(row, col, value(mersenne));
+            }
+        }
+
+        ds::convolution<float> convolution;
+        ds::table<float> target;
+
+        for (auto const density: {0.0, 0.25, 2.0}) {
+            convolution.density = density;
+
+            convolution.separable(source, target, gradient, smooth);
+            expect_convolved(source, target, gradient, smooth);
+
+            convolution.separable(source, target, smooth, std::vector {1.0f});
+            expect_convolved(source, target, smooth, std::vector {1.0f});
+        }
+    }
+}
@@ -0,0 +1,102 @@
+//! @file distance.cpp
+//! @date 17/10/26
+//! @brief Tests for nearest-occupied-cell queries and distance transforms.
+//! @author David Spry
+
+#include <cmath>
+#include <random>
+#include <limits>
+#include <algorithm>
+#include <gtest/gtest.h>
+
+#include "../include/table/distance.hpp"
+
+namespace {
+float brute_force(ds::table<int> const& table, int const row, int const col, ds::metric const measure) {
+    auto best = std::numeric_limits<float>::infinity();
+    auto const [rows, cols] = table.dimensions();
+
+    for (auto y = 0; y < static_cast<int>(rows); ++y) {
+        for (auto x = 0; x < static_cast<int>(cols); ++x) {
+            if (!table.contains(y, x))
+                continue;
+
+            auto const dy = static_cast<float>(y - row);
+            auto const dx = static_cast<float>(x - col);
+            auto const d = measure == ds::metric::euclidean ? std::sqrt(dy * dy + dx * dx)
+                                                            : std::max(std::abs(dy), std::abs(dx));
+            best = std::min(best, d);
+        }
+    }
+
+    return best;
+}
+
+}
+
+TEST(Distance, EmptyTable) {
+    ds::table<int> table(3, 3);
+    ds::distance_field field;
+    field.build(table);
+
+    EXPECT_EQ(ds::nearest_occupied(table, 1, 1), std::pair(-1, -1));
+    EXPECT_EQ(field.nearest(1, 1), std::pair(-1, -1));
+    EXPECT_TRUE(std::isinf(field.distance(1, 1)));
+}
+
+TEST(Distance, NearestOccupied) {
+    ds::table<int> table(20, 30);
+    table.emplace(2, 3, 1);
+    table.emplace(15, 25, 1);
+
+    EXPECT_EQ(ds::nearest_occupied(table, 2, 3), std::pair(2, 3));
+    EXPECT_EQ(ds::nearest_occupied(table, 0, 0), std::pair(2, 3));
+    EXPECT_EQ(ds::nearest_occupied(table, 19, 29), std::pair(15, 25));
+    EXPECT_EQ(ds::nearest_occupied(table, 10, 20, ds::metric::chebyshev), std::pair(15, 25));
+}
+
+TEST(Distance, TransformMatchesBruteForce) {
+    std::mt19937 mersenne(11);
+
+    for (auto const density: {0.002, 0.05, 0.4}) {
+        for (auto const measure: {ds::metric::euclidean, ds::metric::chebyshev}) {
+            ds::table<int> table(37, 53);
+            std::bernoulli_distribution occupied(density);
+            table.scroll(measure == ds::metric::euclidean ? 0 : 11, 20);
+
+            for (auto row = 0; row < 37; ++row) {
+                for (auto col = 0; col < 53; ++col) {
+                    if (occupied(mersenne))
+                        table.emplace(row, col, 1);
+                }
+            }
+
+            if (table.empty())
+                table.emplace(5, 5, 1);
+
+            ds::distance_field field;
+            field.build(table, measure);
+
+            for (auto row = 0; row < 37; ++row) {
+                for (auto col = 0; col < 53; ++col) {
+                    auto const expected = brute_force(table, row, col, measure);
+                    EXPECT_NEAR(field.distance(row, col), expected, 1e-4f);
+
+                    auto const [y, x] = field.nearest(row, col);
+                    ASSERT_TRUE(table.contains(y, x));
+
+                    auto const [ny, nx] = ds::nearest_occupied(table, row, col, measure);
+                    ASSERT_TRUE(table.contains(ny, nx));
+
+                    for (auto const& [sy, sx]: {std::pair {y, x}, {ny, nx}}) {
+                        auto const dy = static_cast<float>(sy - row);
+                        auto const dx = static_cast<float>(sx - col);
+                        auto const d = measure == ds::metric::euclidean ? std::sqrt(dy * dy + dx * dx)
+                                                                        : std::max(std::abs(dy), std::abs(dx));
+                        EXPECT_NEAR(d, expected, 1e-4f);
+                    }
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,166 @@
+//! @file file_table.cpp
+//! @date 17/10/26
+//! @brief Tests for the writable memory-mapped table.
+//! @author David Spry
+
+#include <string>
+#include <cstdio>
+#include <fcntl.h>
+#include <filesystem>
+#include <sys/wait.h>
+#include <gtest/gtest.h>
+
+#include "../include/table/file_table.hpp"
+
+namespace {
+
+std::string table_file(char const* name) {
+    return (std::filesystem::temp_directory_path() / (name + std::to_string(::getpid()))).string();
+}
+
+}
+
+TEST(FileTable, GrowAndReopen) {
+    constexpr auto size = 32;
+    auto const path = table_file("ds_file_table_reopen_");
+
+    {
+        ds::file_table<int> table(path, size, size, 4);
+        EXPECT_EQ(table.capacity(), 4);
+
+        for (auto k = 0; k < size * size; k += 3) {
+            table.set(k / size, k % size, k);
+        }
+
+        EXPECT_GE(table.capacity(), table.count());
+        EXPECT_EQ(table.count(), (size * size + 2) / 3);
+
+        table.erase(0, 0);
+        table.set(0, 3, -3);
+        table.sync();
+        EXPECT_EQ(table.generation(), 2);
+    }
+
+    ds::file_table<int> table(path);
+    EXPECT_FALSE(table.recovered());
+    EXPECT_EQ(table.count(), (size * size + 2) / 3 - 1);
+    EXPECT_EQ(table.generation(), 2);
+    EXPECT_FALSE(table.contains(0, 0));
+    EXPECT_EQ(*table.get(0, 3), -3);
+
+    for (auto k = 6; k < size * size; k += 3) {
+        ASSERT_NE(table.get(k / size, k % size), nullptr);
+        ASSERT_EQ(*table.get(k / size, k % size), k);
+    }
+
+    table.reserve(size * size * 2);
+    EXPECT_EQ(table.capacity(), size * size);
+
+    EXPECT_THROW(ds::file_table<double> {path}, std::runtime_error);
+    std::remove(path.c_str());
+}
+
+TEST(FileTable, RecoverInterruptedWrite) {
+    constexpr auto size = 16;
+    auto const path = table_file("ds_file_table_recover_");
+
+    auto const child = ::fork();
+    ASSERT_GE(child, 0);
+
+    if (child == 0) {
+        ds::file_table<int> table(path, size, size, 2);
+        for (auto k = 0; k < 10; ++k) {
+            table.set(k, k, k);
+        }
+
+        table.erase(3, 3);
+        table.write([](auto& t) {
+            t.set(15, 0, 100);
+            t.set(15, 1, 101);
+            ::_exit(0);
+        });
+    }
+
+    auto status = 0;
+    ::waitpid(child, &status, 0);
+    ASSERT_EQ(WEXITSTATUS(status), 0);
+
+    ds::file_table<int> table(path);
+    EXPECT_TRUE(table.recovered());
+    EXPECT_EQ(table.version() % 2, 0);
+    EXPECT_EQ(table.count(), 11);
+    EXPECT_FALSE(table.contains(3, 3));
+    EXPECT_EQ(*table.get(15, 1), 101);
+
+    for (auto k = 0; k < 10; ++k) {
+        if (k != 3) {
+            EXPECT_EQ(*table.get(k, k), k);
+        }
+    }
+
+    std::remove(path.c_str());
+}
+
+TEST(FileTable, RecoverStaleHeader) {
+    constexpr auto size = 64;
+    auto const path = table_file("ds_file_table_stale_");
+
+    auto const child = ::fork();
+    ASSERT_GE(child, 0);
+
+    if (child == 0) {
+        ds::file_table<int> table(path, size, size, 64);
+        for (auto k = 0; k < 40; ++k) {
+            table.set(k, 0, k);
+        }
+
+        table.sync();
+        table.set(0, 1, -1);
+
+        // Persist the data without the header, as if the kernel had written the pages back out of order.
+        ds::mapped_header stale;
+        auto const descriptor = ::open(path.c_str(), O_RDWR);
+        auto const bytes = static_cast<ssize_t>(sizeof(stale));
+        auto const read = ::pread(descriptor, &stale, sizeof(stale), 0) == bytes;
+
+        table.set(40, 0, 40);
+        auto const written = ::pwrite(descriptor, &stale, sizeof(stale), 0) == bytes;
+        ::_exit(read && written ? 0 : 1);
+    }
+
+    auto status = 0;
+    ::waitpid(child, &status, 0);
+    ASSERT_EQ(WEXITSTATUS(status), 0);
+
+    {
+        ds::file_table<int> table(path);
+        EXPECT_TRUE(table.recovered());
+        EXPECT_EQ(table.count(), 41);
+        EXPECT_FALSE(table.contains(40, 0));
+        EXPECT_EQ(*table.get(0, 1), -1);
+
+        table.set(50, 0, 3);
+        EXPECT_FALSE(table.contains(40, 0));
+        EXPECT_EQ(*table.get(50, 0), 3);
+        EXPECT_EQ(*table.get(39, 0), 39);
+    }
+
+    // Point an empty cell of the clean table past the last data item, which only `verify` detects.
+    ds::mapped_header header;
+    auto const descriptor = ::open(path.c_str(), O_RDWR);
+    ASSERT_EQ(::pread(descriptor, &header, sizeof(header), 0), static_cast<ssize_t>(sizeof(header)));
+
+    auto const slot = static_cast<int>(header.count);
+    auto const offset = static_cast<off_t>(header.table_indices_offset + 45 * size * sizeof(int));
+    ASSERT_EQ(::pwrite(descriptor, &slot, sizeof(slot), offset), static_cast<ssize_t>(sizeof(slot)));
+    ::close(descriptor);
+
+    EXPECT_FALSE(ds::file_table<int>(path).recovered());
+
+    ds::file_table<int> table(path, true);
+    EXPECT_TRUE(table.recovered());
+    EXPECT_FALSE(table.contains(45, 0));
+    EXPECT_EQ(table.count(), 42);
+
+    std::remove(path.c_str());
+}
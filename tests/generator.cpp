@@ -0,0 +1,96 @@
+//! @file generator.cpp
+//! @date 17/10/26
+//! @brief Tests for the C++20 coroutine scans of a table.
+//! @author David Spry
+
+#include <vector>
+#include <ranges>
+#include <gtest/gtest.h>
+
+#include "../include/table/generator.hpp"
+
+static_assert(std::ranges::input_range<ds::generator<int>>);
+
+TEST(Generator, ScanRegion) {
+    ds::table<int> table(6, 6);
+
+    for (auto i = 0; i < 6; ++i) {
+        table.emplace(i, i, i);
+        table.emplace(i, 5 - i, 10 + i);
+    }
+
+    std::vector<std::tuple<int, int, int>> cells;
+    for (auto const [row, col, value]: ds::scan(table, {1, 1, 3, 3})) {
+        cells.emplace_back(row, col, value);
+    }
+
+    std::vector<std::tuple<int, int, int>> const expected {{1, 1, 1}, {2, 2, 2}, {2, 3, 12}, {3, 3, 3}, {3, 2, 13}};
+    ASSERT_EQ(cells.size(), 5);
+    for (auto const& item: expected) {
+        EXPECT_NE(std::find(cells.begin(), cells.end(), item), cells.end());
+    }
+
+    auto count = 0;
+    for (auto const& item: ds::scan(table, {-10, -10, 100, 100}, [](int value) { return value >= 10; })) {
+        EXPECT_GE(item.value, 10);
+        ++count;
+    }
+
+    EXPECT_EQ(count, 6);
+    EXPECT_EQ(std::ranges::distance(ds::scan(table, {0, 6, 6, 6})), 0);
+
+    table.scroll(1, 1);
+    cells.clear();
+    for (auto const [row, col, value]: ds::scan(table, {0, 0, 2, 2})) {
+        cells.emplace_back(row, col, value);
+    }
+
+    EXPECT_EQ(cells, (std::vector<std::tuple<int, int, int>> {{0, 0, 1}, {1, 1, 2}}));
+
+    count = 0;
+    for (auto const& item: ds::scan(table, {0, 0, 6, 6}, [](int value) { return value >= 10; })) {
+        EXPECT_EQ(item.row + item.column, 3);
+        ++count;
+    }
+
+    EXPECT_EQ(count, 4);
+}
+
+TEST(Generator, ScanIsLazy) {
+    ds::table<int> table(100, 100);
+    for (auto row = 0; row < 100; ++row) {
+        table.emplace(row, row, row);
+    }
+
+    auto evaluated = 0;
+    auto generator = ds::scan(table, {0, 0, 100, 100}, [&](int) { ++evaluated; return true; });
+
+    auto it = generator.begin();
+    EXPECT_EQ(evaluated, 1);
+
+    ++it;
+    ++it;
+    EXPECT_EQ(evaluated, 3);
+}
+
+TEST(Generator, Chunks) {
+    ds::table<int> table(10, 10);
+    for (auto row = 0; row < 10; ++row) {
+        for (auto col = 0; col < 10; ++col) {
+            table.emplace(row, col, row * 10 + col);
+        }
+    }
+
+    std::vector<std::size_t> sizes;
+    auto sum = 0;
+
+    for (auto const chunk: ds::chunks(table, {0, 0, 5, 5}, [](int value) { return value % 2 == 0; }, 4)) {
+        sizes.push_back(chunk.size());
+        for (auto const& item: chunk) {
+            sum += item.value;
+        }
+    }
+
+    EXPECT_EQ(sizes, (std::vector<std::size_t> {4, 4, 4, 3}));
+    EXPECT_EQ(sum, 330);
+}
@@ -0,0 +1,134 @@
+//! @file handoff.cpp
+//! @date 17/10/26
+//! @brief Tests for the wait-free handoff of edits and snapshots between threads.
+//! @author David Spry
+
+#include <thread>
+#include <gtest/gtest.h>
+
+#include "../include/table/handoff.hpp"
+
+TEST(Handoff, EditQueue) {
+    ds::table<int> table(4, 4);
+    ds::edit_queue<int, 4> queue;
+    table.reserve(2);
+
+    EXPECT_TRUE(queue.set(0, 0, 1));
+    EXPECT_TRUE(queue.set(1, 1, 2));
+    EXPECT_TRUE(queue.set(2, 2, 3));
+    EXPECT_TRUE(queue.erase(0, 0));
+    EXPECT_FALSE(queue.set(3, 3, 4));
+    EXPECT_EQ(queue.size(), 4);
+
+    EXPECT_EQ(queue.apply(table, 2), 2);
+    EXPECT_EQ(table.count(), 2);
+    EXPECT_EQ(queue.size(), 2);
+
+    EXPECT_EQ(queue.apply(table), 2);
+    EXPECT_EQ(queue.rejected(), 1);
+    EXPECT_EQ(table.count(), 1);
+    EXPECT_FALSE(table.contains(0, 0));
+    EXPECT_FALSE(table.contains(2, 2));
+    EXPECT_EQ(table.at(1, 1), 2);
+
+    EXPECT_TRUE(queue.set(3, 3, 4));
+    EXPECT_EQ(queue.apply(table), 1);
+    EXPECT_EQ(table.at(3, 3), 4);
+    EXPECT_EQ(queue.apply(table), 0);
+
+    EXPECT_TRUE(queue.set(4, 0, 5));
+    EXPECT_TRUE(queue.erase(0, -1));
+    EXPECT_EQ(queue.apply(table), 2);
+    EXPECT_EQ(queue.rejected(), 3);
+    EXPECT_EQ(table.count(), 2);
+}
+
+TEST(Handoff, ConcurrentEdits) {
+    constexpr auto size = 32;
+    constexpr auto edits = 50000;
+
+    ds::table<int> table(size, size);
+    ds::table<int> expected(size, size);
+    ds::edit_queue<int, 256> queue;
+    table.reserve(size * size);
+
+    for (auto k = 0; k < edits; ++k) {
+        auto const t = (k * 7919) % (size * size);
+        if (k % 3 == 2) {
+            if (expected.contains(t / size, t % size))
+                expected.erase(t / size, t % size);
+        } else {
+            expected.set(t / size, t % size, k);
+        }
+    }
+
+    std::thread producer([&queue] {
+        for (auto k = 0; k < edits; ++k) {
+            auto const t = (k * 7919) % (size * size);
+            auto const row = t / size;
+            auto const col = t % size;
+
+            while (!(k % 3 == 2 ? queue.erase(row, col) : queue.set(row, col, k))) {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    for (auto applied = std::size_t {0}; applied < edits;) {
+        applied += queue.apply(table, 64);
+    }
+
+    producer.join();
+
+    EXPECT_EQ(queue.rejected(), 0);
+    ASSERT_EQ(table.count(), expected.count());
+    for (auto row = 0; row < size; ++row) {
+        for (auto col = 0; col < size; ++col) {
+            auto const x = table.get(row, col);
+            auto const y = expected.get(row, col);
+            ASSERT_EQ(x == nullptr, y == nullptr);
+            if (x) {
+                EXPECT_EQ(*x, *y);
+            }
+        }
+    }
+}
+
+TEST(Handoff, TripleBuffer) {
+    constexpr auto size = 16;
+    constexpr auto generations = 5000;
+
+    ds::triple_buffer<ds::table<int>> snapshots;
+    EXPECT_EQ(snapshots.read().count(), 0);
+
+    std::thread writer([&snapshots] {
+        ds::table<int> table(size, size);
+        for (auto generation = 1; generation <= generations; ++generation) {
+            table.reset();
+            for (auto k = 0; k < size; ++k) {
+                table.set(k, (k + generation) % size, generation);
+            }
+
+            snapshots.publish(table);
+        }
+    });
+
+    auto last = 0;
+    while (last < generations) {
+        auto const& snapshot = snapshots.read();
+        if (snapshot.count() == 0)
+            continue;
+
+        auto const generation = *snapshot.data();
+        ASSERT_GE(generation, last);
+        ASSERT_EQ(snapshot.count(), size);
+
+        for (auto k = 0; k < size; ++k) {
+            ASSERT_EQ(snapshot.at(k, (k + generation) % size), generation);
+        }
+
+        last = generation;
+    }
+
+    writer.join();
+}
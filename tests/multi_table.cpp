@@ -0,0 +1,125 @@
+//! @file multi_table.cpp
+//! @date 17/10/26
+//! @brief Tests for the multi-table, whose cells hold any number of data items.
+//! @author David Spry
+
+#include <random>
+#include <vector>
+#include <algorithm>
+#include <stdexcept>
+#include <gtest/gtest.h>
+
+#include "../include/table/multi_table.hpp"
+
+namespace {
+template<typename T>
+std::vector<T> items_in_cell(ds::multi_table<T> const& table, int const row, int const column) {
+    std::vector<T> items;
+    table.for_each_in_cell(row, column, [&](T const& value) { items.push_back(value); });
+    std::sort(items.begin(), items.end());
+    return items;
+}
+}
+
+TEST(MultiTable, InsertEraseMove) {
+    ds::multi_table<int> table(3, 3);
+
+    auto const a = table.insert(1, 1, 10);
+    auto const b = table.insert(1, 1, 20);
+    auto const c = table.emplace(2, 0, 30);
+
+    EXPECT_EQ(table.count(), 3);
+    EXPECT_EQ(table.count(1, 1), 2);
+    EXPECT_EQ(table.count(0, 0), 0);
+    EXPECT_EQ(items_in_cell(table, 1, 1), (std::vector {10, 20}));
+    EXPECT_EQ(table.position(c), std::make_pair(2, 0));
+
+    table.move(a, 2, 0);
+    EXPECT_EQ(items_in_cell(table, 1, 1), (std::vector {20}));
+    EXPECT_EQ(items_in_cell(table, 2, 0), (std::vector {10, 30}));
+
+    table.erase(a);
+    EXPECT_EQ(table.count(), 2);
+    EXPECT_EQ(table[a], 30);
+    EXPECT_EQ(table.position(a), std::make_pair(2, 0));
+    EXPECT_EQ(items_in_cell(table, 2, 0), (std::vector {30}));
+    EXPECT_EQ(table[b], 20);
+
+    EXPECT_THROW(table.insert(3, 0, 1), std::out_of_range);
+    EXPECT_THROW(table.move(b, 0, -1), std::out_of_range);
+
+    table.rebuild();
+    EXPECT_TRUE(table.empty());
+    EXPECT_EQ(table.count(1, 1), 0);
+    EXPECT_TRUE(items_in_cell(table, 2, 0).empty());
+
+    table.insert(1, 1, 5);
+    EXPECT_EQ(items_in_cell(table, 1, 1), (std::vector {5}));
+    EXPECT_EQ(table.count(2, 0), 0);
+}
+
+TEST(MultiTable, AgainstModel) {
+    int const rows = 6;
+    int const cols = 7;
+
+    ds::multi_table<int> table(rows, cols);
+    std::vector<std::pair<int, int>> model;
+
+    std::mt19937 mersenne(8);
+    std::uniform_int_distribution<int> row(0, rows - 1);
+    std::uniform_int_distribution<int> col(0, cols - 1);
+    std::uniform_int_distribution<int> action(0, 9);
+
+    for (auto step = 0; step < 5000; ++step) {
+        auto const a = action(mersenne);
+
+        if (a == 0) {
+            table.rebuild();
+            model.clear();
+        } else if (a < 5 || model.empty()) {
+            auto const r = row(mersenne);
+            auto const c = col(mersenne);
+            EXPECT_EQ(table.insert(r, c, step), static_cast<int>(model.size()));
+            model.emplace_back(r * cols + c, step);
+        } else if (a < 8) {
+            auto const item = static_cast<int>(mersenne() % model.size());
+            table.erase(item);
+            model[item] = model.back();
+            model.pop_back();
+        } else {
+            auto const item = static_cast<int>(mersenne() % model.size());
+            auto const r = row(mersenne);
+            auto const c = col(mersenne);
+            table.move(item, r, c);
+            model[item].first = r * cols + c;
+        }
+
+        ASSERT_EQ(table.count(), model.size());
+        for (auto item = 0; item < static_cast<int>(model.size()); ++item) {
+            ASSERT_EQ(table[item], model[item].second);
+            ASSERT_EQ(table.position(item), std::make_pair(model[item].first / cols, model[item].first % cols));
+        }
+
+        if (step % 50 == 0) {
+            for (auto t = 0; t < rows * cols; ++t) {
+                std::vector<int> expected;
+                for (auto const& [cell, value]: model) {
+                    if (cell == t)
+                        expected.push_back(value);
+                }
+
+                std::sort(expected.begin(), expected.end());
+                ASSERT_EQ(items_in_cell(table, t / cols, t % cols), expected);
+                ASSERT_EQ(table.count(t / cols, t % cols), static_cast<int>(expected.size()));
+            }
+        }
+    }
+
+    auto visited = 0;
+    table.for_each_in_cell(0, 0, [&](int item, int& value) {
+        EXPECT_EQ(&value, &table[item]);
+        ++visited;
+    });
+
+    EXPECT_EQ(visited, table.count(0, 0));
+}
@@ -0,0 +1,91 @@
+//! @file paged_table.cpp
+//! @date 17/10/26
+//! @brief Tests for the out-of-core paged table.
+//! @author David Spry
+
+#include <string>
+#include <cstdio>
+#include <filesystem>
+#include <gtest/gtest.h>
+
+#include "../include/table/paged_table.hpp"
+
+namespace {
+
+std::string backing_file(char const* name) {
+    return (std::filesystem::temp_directory_path() / name).string();
+}
+
+}
+
+TEST(PagedTable, GetSetErase) {
+    auto const path = backing_file("ds_paged_table_basic.bin");
+    ds::paged_table<int> table(path, 100, 70, 1 << 20, 16);
+
+    EXPECT_EQ(table.dimensions(), std::make_pair(std::size_t {100}, std::size_t {70}));
+    EXPECT_EQ(table.get(5, 5), nullptr);
+    EXPECT_FALSE(table.contains(5, 5));
+
+    table.set(5, 5, 1);
+    table.set(99, 69, 2);
+    table.set(5, 5, 3);
+    EXPECT_EQ(table.count(), 2);
+    EXPECT_EQ(*table.get(5, 5), 3);
+    EXPECT_EQ(*table.get(99, 69), 2);
+
+    table.erase(5, 5);
+    table.erase(5, 5);
+    EXPECT_EQ(table.count(), 1);
+    EXPECT_FALSE(table.contains(5, 5));
+
+    EXPECT_THROW(table.get(100, 0), std::out_of_range);
+    EXPECT_THROW(table.set(0, -1, 0), std::out_of_range);
+    EXPECT_THROW(ds::paged_table<int>(path, 100, 70, 1 << 20, 0), std::invalid_argument);
+
+    std::remove(path.c_str());
+}
+
+TEST(PagedTable, Eviction) {
+    constexpr auto size = 256;
+    constexpr auto tile = 16;
+
+    auto const path = backing_file("ds_paged_table_eviction.bin");
+    auto const record = tile * tile / 8 + tile * tile * sizeof(int);
+
+    ds::table<int> expected(size, size);
+    ds::paged_table<int> table(path, size, size, 4 * record, tile);
+
+    for (auto k = 0; k < 20000; ++k) {
+        auto const t = (k * 7919) % (size * size);
+        if (k % 4 == 3) {
+            table.erase(t / size, t % size);
+            if (expected.contains(t / size, t % size))
+                expected.erase(t / size, t % size);
+        } else {
+            table.set(t / size, t % size, k);
+            expected.set(t / size, t % size, k);
+        }
+    }
+
+    EXPECT_GT(table.evictions(), 0);
+    EXPECT_EQ(table.count(), expected.count());
+
+    auto const check = [&] {
+        for (auto row = 0; row < size; ++row) {
+            for (auto col = 0; col < size; ++col) {
+                auto const x = table.get(row, col);
+                auto const y = expected.get(row, col);
+                ASSERT_EQ(x == nullptr, y == nullptr);
+                if (x) {
+                    ASSERT_EQ(*x, *y);
+                }
+            }
+        }
+    };
+
+    check();
+    table.flush();
+    check();
+
+    std::remove(path.c_str());
+}
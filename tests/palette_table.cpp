@@ -0,0 +1,112 @@
+//! @file palette_table.cpp
+//! @date 17/10/26
+//! @brief Tests for the palette-compressed table.
+//! @author David Spry
+
+#include <gtest/gtest.h>
+
+#include "../include/table/palette_table.hpp"
+
+TEST(PaletteTable, GetSetErase) {
+    ds::palette_table<int> table(10, 13);
+    EXPECT_EQ(table.count(), 0);
+    EXPECT_EQ(table.bits(), 1);
+    EXPECT_EQ(table.get(0, 0), nullptr);
+
+    table.set(0, 0, 7);
+    table.set(9, 12, 7);
+    EXPECT_EQ(table.bits(), 1);
+    EXPECT_EQ(table.palette().size(), 1);
+
+    table.set(4, 4, 8);
+    EXPECT_EQ(table.bits(), 2);
+    EXPECT_EQ(*table.get(0, 0), 7);
+    EXPECT_EQ(*table.get(9, 12), 7);
+    EXPECT_EQ(*table.get(4, 4), 8);
+    EXPECT_EQ(table.index(0, 0), *table.find(7));
+    EXPECT_EQ(table.count(), 3);
+
+    table.set(4, 4, 7);
+    EXPECT_FALSE(table.find(8).has_value());
+    EXPECT_EQ(table.count(7), 3);
+
+    table.erase(0, 0);
+    table.erase(0, 0);
+    EXPECT_EQ(table.count(), 2);
+    EXPECT_FALSE(table.contains(0, 0));
+
+    EXPECT_THROW(table.set(10, 0, 1), std::out_of_range);
+    EXPECT_THROW(table.get(0, 13), std::out_of_range);
+
+    table.reset();
+    EXPECT_EQ(table.count(), 0);
+    EXPECT_EQ(table.count(7), 0);
+}
+
+TEST(PaletteTable, GrowAndCompact) {
+    constexpr auto rows = 37;
+    constexpr auto cols = 41;
+
+    ds::palette_table<int> table(rows, cols);
+    ds::table<int> expected(rows, cols);
+
+    for (auto k = 0; k < rows * cols; ++k) {
+        auto const value = (k * 31) % 300;
+        table.set(k / cols, k % cols, value);
+        expected.set(k / cols, k % cols, value);
+    }
+
+    EXPECT_EQ(table.bits(), 16);
+    EXPECT_EQ(table.palette().size(), 300);
+
+    for (auto k = 0; k < rows * cols; ++k) {
+        if ((k * 31) % 300 >= 20) {
+            table.set(k / cols, k % cols, (k * 31) % 20);
+            expected.set(k / cols, k % cols, (k * 31) % 20);
+        }
+    }
+
+    table.erase(3, 3);
+    expected.erase(3, 3);
+    table.compact();
+    EXPECT_EQ(table.bits(), 8);
+    EXPECT_EQ(table.palette().size(), 20);
+    EXPECT_EQ(table.count(), expected.count());
+
+    for (auto row = 0; row < rows; ++row) {
+        for (auto col = 0; col < cols; ++col) {
+            auto const x = table.get(row, col);
+            auto const y = expected.get(row, col);
+            ASSERT_EQ(x == nullptr, y == nullptr);
+            if (x) {
+                ASSERT_EQ(*x, *y);
+            }
+        }
+    }
+}
+
+TEST(PaletteTable, FilterByValue) {
+    for (auto const kinds: {2, 3, 10, 200, 70000}) {
+        ds::palette_table<int> table(19, 23);
+        for (auto k = 0; k < 19 * 23; ++k) {
+            if (k % 5 != 0) {
+                table.set(k / 23, k % 23, k % kinds);
+            }
+        }
+
+        for (auto const value: {0, 1, kinds - 1}) {
+            std::vector<std::pair<int, int>> expected;
+            for (auto k = 0; k < 19 * 23; ++k) {
+                if (k % 5 != 0 && k % kinds == value)
+                    expected.emplace_back(k / 23, k % 23);
+            }
+
+            std::vector<std::pair<int, int>> found;
+            table.for_each_equal(value, [&](int row, int col) { found.emplace_back(row, col); });
+            EXPECT_EQ(found, expected);
+            EXPECT_EQ(table.count(value), expected.size());
+        }
+
+        EXPECT_EQ(table.count(-1), 0);
+    }
+}
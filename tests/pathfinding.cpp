@@ -0,0 +1,122 @@
+//! @file pathfinding.cpp
+//! @date 17/10/26
+//! @brief Tests for A* and Jump Point Search over a table.
+//! @author David Spry
+
+#include <cmath>
+#include <random>
+#include <vector>
+#include <gtest/gtest.h>
+
+#include "../include/table/pathfinding.hpp"
+
+namespace {
+using path_type = std::vector<ds::pathfinder::position>;
+
+template<typename grid>
+void expect_valid(grid const& table, path_type const& path, ds::pathfinder::position from, ds::pathfinder::position to) {
+    ASSERT_FALSE(path.empty());
+    EXPECT_EQ(path.front(), from);
+    EXPECT_EQ(path.back(), to);
+
+    for (auto i = std::size_t {1}; i < path.size(); ++i) {
+        auto const [y, x] = path[i];
+        auto const [py, px] = path[i - 1];
+        EXPECT_LE(std::abs(y - py), 1);
+        EXPECT_LE(std::abs(x - px), 1);
+        EXPECT_FALSE(table.contains(y, x));
+        EXPECT_FALSE(table.contains(py, x) || table.contains(y, px));
+    }
+}
+}
+
+TEST(Pathfinding, StraightAndBlocked) {
+    ds::table<int> table(5, 5);
+    ds::pathfinder pathfinder;
+    path_type path;
+
+    ASSERT_TRUE(pathfinder.find_path(table, {0, 0}, {0, 4}, path));
+    EXPECT_EQ(path.size(), 5);
+    EXPECT_FLOAT_EQ(pathfinder.distance(), 4.0f);
+
+    ASSERT_TRUE(pathfinder.find_path(table, {0, 0}, {4, 4}, path));
+    EXPECT_EQ(path.size(), 5);
+    EXPECT_NEAR(pathfinder.distance(), 4.0f * std::sqrt(2.0f), 1e-4f);
+
+    for (auto row = 0; row < 5; ++row) {
+        table.emplace(row, 2, 1);
+    }
+
+    EXPECT_FALSE(pathfinder.find_path(table, {0, 0}, {0, 4}, path));
+    EXPECT_TRUE(path.empty());
+    EXPECT_FALSE(pathfinder.find_path(table, {0, 0}, {0, 2}, path));
+
+    table.erase(4, 2);
+    ASSERT_TRUE(pathfinder.find_path(table, {0, 0}, {0, 4}, path));
+    expect_valid(table, path, {0, 0}, {0, 4});
+}
+
+TEST(Pathfinding, WeightedCells) {
+    ds::table<int> table(3, 5);
+
+    //  | _ | 9 | _ | _ | _ |
+    //  | _ | 9 | 9 | 9 | _ |
+    //  | _ | _ | _ | _ | _ |
+
+    for (auto [row, col]: {std::pair {0, 1}, {1, 1}, {1, 2}, {1, 3}}) {
+        table.emplace(row, col, 9);
+    }
+
+    auto const weight = [](int const* cell) { return cell ? *cell : 1; };
+
+    ds::pathfinder pathfinder;
+    path_type path;
+
+    ASSERT_TRUE(pathfinder.find_path(table, {0, 0}, {0, 2}, path, weight));
+    expect_valid(ds::table<int>(3, 5), path, {0, 0}, {0, 2});
+    EXPECT_NEAR(pathfinder.distance(), 4.0f + 3.0f * std::sqrt(2.0f), 1e-4f);
+
+    auto const impassable = [](int const* cell) { return cell ? -1 : 1; };
+    ASSERT_TRUE(pathfinder.find_path(table, {0, 0}, {0, 2}, path, impassable));
+    expect_valid(table, path, {0, 0}, {0, 2});
+    EXPECT_FLOAT_EQ(pathfinder.distance(), 10.0f);
+}
+
+TEST(Pathfinding, JumpPointSearchMatchesAStar) {
+    std::mt19937 mersenne(7);
+    std::bernoulli_distribution occupied(0.3);
+    std::uniform_int_distribution<int> position(0, 39);
+
+    ds::pathfinder jps;
+    ds::pathfinder astar;
+    path_type a;
+    path_type b;
+
+    for (auto trial = 0; trial < 50; ++trial) {
+        ds::table<int> table(40, 40);
+        table.scroll(trial % 7, trial % 3);
+
+        for (auto row = 0; row < 40; ++row) {
+            for (auto col = 0; col < 40; ++col) {
+                if (occupied(mersenne))
+                    table.emplace(row, col, 1);
+            }
+        }
+
+        ds::pathfinder::position const from {position(mersenne), position(mersenne)};
+        ds::pathfinder::position const to {position(mersenne), position(mersenne)};
+        for (auto const& [row, col]: {from, to}) {
+            if (table.contains(row, col))
+                table.erase(row, col);
+        }
+
+        auto const found = jps.find_path(table, from, to, a);
+        auto const expected = astar.find_path(table, from, to, b, [](int const* cell) { return cell ? -1 : 1; });
+
+        ASSERT_EQ(found, expected);
+        if (found) {
+            expect_valid(table, a, from, to);
+            EXPECT_NEAR(jps.distance(), astar.distance(), 1e-3f);
+        }
+    }
+}
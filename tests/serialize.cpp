@@ -0,0 +1,159 @@
+//! @file serialize.cpp
+//! @date 17/10/26
+//! @brief Tests for the compressed serialisation of a table.
+//! @author David Spry
+
+#include <random>
+#include <sstream>
+#include <fstream>
+#include <gtest/gtest.h>
+
+#include "../include/table/serialize.hpp"
+
+namespace {
+template<typename A, typename B>
+void expect_equal(A const& a, B const& b) {
+    ASSERT_EQ(a.dimensions(), b.dimensions());
+    ASSERT_EQ(a.count(), b.count());
+
+    auto const [rows, cols] = a.dimensions();
+    for (auto row = 0; row < static_cast<int>(rows); ++row) {
+        for (auto col = 0; col < static_cast<int>(cols); ++col) {
+            auto const x = a.get(row, col);
+            auto const y = b.get(row, col);
+            ASSERT_EQ(x == nullptr, y == nullptr);
+            if (x) {
+                EXPECT_EQ(*x, *y);
+            }
+        }
+    }
+}
+
+ds::table<int> random_table(double const density, unsigned const seed) {
+    ds::table<int> table(57, 83);
+    std::mt19937 mersenne(seed);
+    std::bernoulli_distribution occupied(density);
+    std::uniform_int_distribution<int> value(-1000, 1000);
+
+    for (auto row = 0; row < 57; ++row) {
+        for (auto col = 0; col < 83; ++col) {
+            if (occupied(mersenne))
+                table.emplace(row, col, value(mersenne));
+        }
+    }
+
+    return table;
+}
+}
+
+TEST(Serialize, Varint) {
+    std::stringstream stream;
+    for (auto const value: {0ull, 1ull, 127ull, 128ull, 300ull, ~0ull}) {
+        ds::write_varint(*stream.rdbuf(), value);
+    }
+
+    EXPECT_EQ(stream.str().size(), 1 + 1 + 1 + 2 + 2 + 10);
+
+    for (auto const value: {0ull, 1ull, 127ull, 128ull, 300ull, ~0ull}) {
+        EXPECT_EQ(ds::read_varint(*stream.rdbuf()), value);
+    }
+
+    EXPECT_THROW(ds::read_varint(*stream.rdbuf()), std::runtime_error);
+}
+
+TEST(Serialize, RoundTrip) {
+    for (auto const density: {0.0, 0.01, 0.5, 1.0}) {
+        auto const table = random_table(density, 17);
+
+        for (auto const encoding: {ds::occupancy_encoding::deltas, ds::occupancy_encoding::runs,
+                                   ds::occupancy_encoding::automatic}) {
+            std::stringstream raw;
+            ds::save(table, raw, encoding);
+            expect_equal(table, ds::load<ds::table<int>>(raw));
+
+            std::stringstream packed;
+            ds::save(table, packed, encoding, ds::varint_codec<int> {});
+            expect_equal(table, ds::load<ds::table<int, ds::row_index>>(packed, ds::varint_codec<int> {}));
+            EXPECT_LE(packed.str().size(), raw.str().size());
+        }
+    }
+}
+
+TEST(Serialize, ScrolledTable) {
+    ds::table<int> table(4, 5);
+    table.set(1, 1, 42);
+    table.set(3, 4, 7);
+    table.scroll(1, 1);
+
+    std::stringstream stream;
+    ds::save(table, stream);
+    auto const loaded = ds::load<ds::table<int>>(stream);
+    expect_equal(table, loaded);
+    EXPECT_EQ(loaded.at(0, 0), 42);
+    EXPECT_EQ(loaded.at(2, 3), 7);
+}
+
+TEST(Serialize, Compression) {
+    auto const sparse = random_table(0.02, 3);
+    std::stringstream stream;
+    ds::save(sparse, stream);
+
+    auto const dump = sparse.size() * sizeof(int) + sparse.count() * (sizeof(int) * 2);
+    EXPECT_LT(stream.str().size() * 4, dump);
+
+    ds::table<int> dense(100, 100);
+    for (auto row = 10; row < 90; ++row) {
+        for (auto col = 10; col < 90; ++col) {
+            dense.emplace(row, col, 0);
+        }
+    }
+
+    std::stringstream deltas;
+    std::stringstream runs;
+    ds::save(dense, deltas, ds::occupancy_encoding::deltas, ds::varint_codec<int> {});
+    ds::save(dense, runs, ds::occupancy_encoding::automatic, ds::varint_codec<int> {});
+    EXPECT_LT(runs.str().size(), deltas.str().size());
+}
+
+TEST(Serialize, FailedWrite) {
+    std::ofstream closed;
+    EXPECT_THROW(ds::save(random_table(0.1, 3), closed), std::runtime_error);
+    EXPECT_THROW(ds::save(random_table(0.1, 3), closed, ds::occupancy_encoding::runs, ds::varint_codec<int> {}), std::runtime_error);
+}
+
+TEST(Serialize, MalformedInput) {
+    std::stringstream empty;
+    EXPECT_THROW(ds::load<ds::table<int>>(empty), std::runtime_error);
+
+    std::stringstream stream;
+    ds::save(random_table(0.1, 5), stream);
+
+    auto bytes = stream.str();
+    std::stringstream truncated(bytes.substr(0, bytes.size() - 1));
+    EXPECT_THROW(ds::load<ds::table<int>>(truncated), std::runtime_error);
+
+    bytes[0] = 'X';
+    std::stringstream corrupt(bytes);
+    EXPECT_THROW(ds::load<ds::table<int>>(corrupt), std::runtime_error);
+
+    for (auto const& [rows, cols]: {std::pair<std::uint64_t, std::uint64_t> {70000, 70000}, {1ull << 32, 1},
+                                   {1, 1ull << 32}, {1ull << 32, 1ull << 32}}) {
+        std::stringstream oversized;
+        oversized.write("DSTB\x01\x00", 6);
+        ds::write_varint(*oversized.rdbuf(), rows);
+        ds::write_varint(*oversized.rdbuf(), cols);
+        ds::write_varint(*oversized.rdbuf(), 0);
+        EXPECT_THROW(ds::load<ds::table<int>>(oversized), std::runtime_error);
+    }
+
+    std::stringstream wrapped;
+    wrapped.write("DSTB\x01\x00", 6);
+    for (auto const field: {4, 4, 2, 1}) {
+        ds::write_varint(*wrapped.rdbuf(), field);
+    }
+
+    wrapped.write("\x01\x00\x00\x00", 4);
+    ds::write_varint(*wrapped.rdbuf(), UINT64_MAX);
+    wrapped.write("\x02\x00\x00\x00", 4);
+    EXPECT_THROW(ds::load<ds::table<int>>(wrapped), std::runtime_error);
+}
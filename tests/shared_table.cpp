@@ -0,0 +1,153 @@
+//! @file shared_table.cpp
+//! @date 17/10/26
+//! @brief Tests for the table in POSIX shared memory.
+//! @author David Spry
+
+#include <string>
+#include <sys/wait.h>
+#include <gtest/gtest.h>
+
+#include "../include/table/shared_table.hpp"
+
+namespace {
+
+std::string object_name(char const* name) {
+    return std::string("/") + name + "_" + std::to_string(::getpid());
+}
+
+}
+
+TEST(SharedTable, CreateAndOpen) {
+    auto const name = object_name("ds_shared_table_basic");
+    ds::shared_table<int> writer(name, 8, 8, 4);
+    ds::shared_table<int> reader(name);
+
+    EXPECT_EQ(reader.dimensions(), std::make_pair(std::size_t {8}, std::size_t {8}));
+    EXPECT_EQ(reader.capacity(), 4);
+    EXPECT_NE(reader.data(), writer.data());
+
+    writer.set(1, 2, 3);
+    writer.set(4, 5, 6);
+    writer.set(1, 2, 7);
+    EXPECT_EQ(reader.count(), 2);
+    EXPECT_EQ(*reader.get(1, 2), 7);
+    EXPECT_EQ(reader.version() % 2, 0);
+
+    auto value = 0;
+    EXPECT_TRUE(reader.read(4, 5, value));
+    EXPECT_EQ(value, 6);
+    EXPECT_FALSE(reader.read(0, 0, value));
+
+    writer.erase(1, 2);
+    EXPECT_FALSE(reader.contains(1, 2));
+    EXPECT_EQ(*reader.get(4, 5), 6);
+    EXPECT_THROW(writer.erase(1, 2), std::out_of_range);
+    EXPECT_THROW(writer.set(8, 0, 0), std::out_of_range);
+
+    writer.write([](auto& table) {
+        table.set(0, 0, 1);
+        table.set(0, 1, 1);
+        table.set(0, 2, 1);
+    });
+    EXPECT_THROW(writer.set(0, 3, 1), std::length_error);
+
+    writer.reset();
+    EXPECT_EQ(reader.count(), 0);
+    EXPECT_FALSE(reader.contains(4, 5));
+
+    EXPECT_TRUE(ds::shared_table<int>::unlink(name));
+    EXPECT_THROW(ds::shared_table<int> {name}, std::system_error);
+    EXPECT_THROW(ds::shared_table<double> {name}, std::system_error);
+}
+
+TEST(SharedTable, IncompatibleValueType) {
+    auto const name = object_name("ds_shared_table_types");
+    ds::shared_table<int> writer(name, 4, 4, 4);
+
+    EXPECT_THROW(ds::shared_table<double> {name}, std::runtime_error);
+    ds::shared_table<int>::unlink(name);
+}
+
+TEST(SharedTable, RecoverFromDeadWriter) {
+    auto const name = object_name("ds_shared_table_dead_writer");
+    ds::shared_table<int> table(name, 4, 4, 4);
+    table.set(1, 1, 5);
+
+    auto const child = ::fork();
+    ASSERT_GE(child, 0);
+
+    if (child == 0) {
+        ds::shared_table<int> writer(name);
+        writer.write([](auto& t) {
+            t.set(2, 2, 6);
+            ::_exit(0);
+        });
+    }
+
+    auto status = 0;
+    ::waitpid(child, &status, 0);
+    EXPECT_EQ(table.version() % 2, 1);
+
+    auto const count = [](auto const& t) { return t.count(); };
+    EXPECT_FALSE(table.try_read(count, 100).has_value());
+    EXPECT_FALSE(table.try_read([](auto const&) {}, 100));
+
+    EXPECT_TRUE(table.recover());
+    EXPECT_FALSE(table.recover());
+    EXPECT_EQ(table.version() % 2, 0);
+    EXPECT_EQ(table.try_read(count, 1), std::optional<std::size_t> {2});
+    EXPECT_TRUE(table.contains(2, 2));
+    EXPECT_EQ(*table.get(1, 1), 5);
+    ds::shared_table<int>::unlink(name);
+}
+
+TEST(SharedTable, ConsistentReadsAcrossProcesses) {
+    constexpr auto size = 16;
+    constexpr auto generations = 2000;
+
+    auto const name = object_name("ds_shared_table_processes");
+    ds::shared_table<int> table(name, size, size, size);
+
+    auto const child = ::fork();
+    ASSERT_GE(child, 0);
+
+    if (child == 0) {
+        ds::shared_table<int> writer(name);
+        for (auto generation = 1; generation <= generations; ++generation) {
+            writer.write([generation](auto& t) {
+                t.reset();
+                for (auto k = 0; k < size; ++k) {
+                    t.set(k, (k + generation) % size, generation);
+                }
+            });
+        }
+
+        ::_exit(0);
+    }
+
+    auto last = 0;
+    while (last < generations) {
+        auto const [generation, consistent] = table.read([](auto const& t) {
+            if (t.count() == 0)
+                return std::make_pair(0, true);
+
+            auto const generation = *t.data();
+            auto consistent = t.count() == size;
+            for (auto k = 0; k < size && consistent; ++k) {
+                auto const value = t.get(k, (k + generation) % size);
+                consistent = value != nullptr && *value == generation;
+            }
+
+            return std::make_pair(generation, consistent);
+        });
+
+        ASSERT_TRUE(consistent);
+        ASSERT_GE(generation, last);
+        last = generation;
+    }
+
+    auto status = 0;
+    ::waitpid(child, &status, 0);
+    EXPECT_EQ(WEXITSTATUS(status), 0);
+    ds::shared_table<int>::unlink(name);
+}
@@ -308,6 +308,547 @@ TEST(Table, SetSize) {
     EXPECT_NO_THROW(table.set_size(0, 0));
 }
 
+TEST(Table, Views) {
+    ds::table<int> table(3, 4);
+    table.emplace(0, 1, 1);
+    table.emplace(2, 1, 9);
+    table.emplace(2, 3, 5);
+
+    ASSERT_EQ(table.rows().size(), 3);
+    ASSERT_EQ(table.row(2).size(), 4);
+    ASSERT_EQ(table.col(1).size(), 3);
+    ASSERT_EQ(table.occupied().size(), 3);
+
+    EXPECT_EQ(table.row(0)[0], nullptr);
+    EXPECT_EQ(*table.row(2)[3], 5);
+    EXPECT_EQ(table.row(2)[1], table.get(2, 1));
+    EXPECT_EQ(*table.col(1)[0], 1);
+    EXPECT_EQ(table.col(1)[1], nullptr);
+    EXPECT_EQ(*table.rows()[2][1], 9);
+
+    auto columns = 0;
+    for (auto const& row: table.rows()) {
+        columns += std::count(row.begin(), row.end(), nullptr);
+    }
+
+    EXPECT_EQ(columns, 12 - 3);
+
+    for (auto const& cell: table.occupied()) {
+        EXPECT_EQ(&cell.value, table.get(cell.row, cell.column));
+    }
+
+    auto const view = table.occupied();
+    auto const it = view.begin() + 2;
+    EXPECT_EQ(it - view.begin(), 2);
+    EXPECT_EQ((*it).value, 5);
+}
+
+TEST(Table, RowOrderedIteration) {
+    std::size_t const rows = 7;
+    std::size_t const cols = 130;
+
+    ds::table<int, ds::row_index> indexed(rows, cols);
+    ds::table<int> plain(rows, cols);
+
+    std::mt19937 mersenne(9);
+    std::uniform_int_distribution<int> row(0, rows - 1);
+    std::uniform_int_distribution<int> col(0, cols - 1);
+
+    for (auto _ = 0; _ < 2000; ++_) {
+        auto const r = row(mersenne);
+        auto const c = col(mersenne);
+
+        if (indexed.contains(r, c) && c % 3 == 0) {
+            indexed.erase(r, c);
+            plain.erase(r, c);
+        } else {
+            indexed.set(r, c, r * 1000 + c);
+            plain.emplace(r, c, r * 1000 + c);
+        }
+    }
+
+    using entry = std::tuple<int, int, int>;
+    std::vector<entry> expected;
+    std::vector<entry> actual;
+    std::vector<entry> fallback;
+
+    for (auto r = 0; r < static_cast<int>(rows); ++r) {
+        for (auto c = 0; c < static_cast<int>(cols); ++c) {
+            if (auto const value = plain.get(r, c))
+                expected.emplace_back(r, c, *value);
+        }
+    }
+
+    indexed.for_each_in_row_major_order([&](int r, int c, int const& value) {
+        EXPECT_EQ(&value, indexed.get(r, c));
+        actual.emplace_back(r, c, value);
+    });
+
+    plain.for_each_in_row_major_order([&](int r, int c, int value) {
+        fallback.emplace_back(r, c, value);
+    });
+
+    EXPECT_EQ(actual, expected);
+    EXPECT_EQ(fallback, expected);
+
+    auto visited = 0;
+    indexed.for_each_in_row(3, [&](int c, int value) {
+        EXPECT_EQ(value, 3000 + c);
+        ++visited;
+    });
+
+    EXPECT_EQ(visited, std::count_if(expected.begin(), expected.end(), [](auto const& e) { return std::get<0>(e) == 3; }));
+
+    indexed.set_size(rows, 64);
+    indexed.reset();
+    indexed.for_each_in_row_major_order([&](int, int, int) { ADD_FAILURE(); });
+}
+
+TEST(Table, ColumnOrderedIteration) {
+    std::size_t const rows = 130;
+    std::size_t const cols = 7;
+
+    ds::table<int, ds::column_index> indexed(rows, cols);
+    ds::table<int> plain(rows, cols);
+
+    std::mt19937 mersenne(11);
+    std::uniform_int_distribution<int> row(0, rows - 1);
+    std::uniform_int_distribution<int> col(0, cols - 1);
+
+    for (auto _ = 0; _ < 2000; ++_) {
+        auto const r = row(mersenne);
+        auto const c = col(mersenne);
+
+        if (indexed.contains(r, c) && r % 3 == 0) {
+            indexed.erase(r, c);
+            plain.erase(r, c);
+        } else {
+            indexed.set(r, c, r * 1000 + c);
+            plain.emplace(r, c, r * 1000 + c);
+        }
+    }
+
+    for (auto c = 0; c < static_cast<int>(cols); ++c) {
+        std::vector<std::pair<int, int>> expected;
+        std::vector<std::pair<int, int>> actual;
+        std::vector<std::pair<int, int>> fallback;
+
+        for (auto r = 0; r < static_cast<int>(rows); ++r) {
+            if (auto const value = plain.get(r, c))
+                expected.emplace_back(r, *value);
+        }
+
+        indexed.for_each_in_column(c, [&](int r, int const& value) {
+            EXPECT_EQ(&value, indexed.get(r, c));
+            actual.emplace_back(r, value);
+        });
+
+        plain.for_each_in_column(c, [&](int r, int value) {
+            fallback.emplace_back(r, value);
+        });
+
+        EXPECT_EQ(actual, expected);
+        EXPECT_EQ(fallback, expected);
+    }
+
+    indexed.reset();
+    indexed.for_each_in_column(0, [&](int, int) { ADD_FAILURE(); });
+}
+
+TEST(Table, OccupancyCounts) {
+    ds::table<int, ds::occupancy_counts> table(3, 4);
+    auto const& counts = table.policy<ds::occupancy_counts>();
+
+    for (auto col = 0; col < 4; ++col) {
+        table.emplace(1, col, col);
+    }
+
+    table.emplace(0, 2, 7);
+    table.emplace(2, 2, 7);
+    table.set(2, 2, 8);
+
+    EXPECT_EQ(table.count_in_row(0), 1);
+    EXPECT_EQ(table.count_in_row(1), 4);
+    EXPECT_EQ(table.count_in_column(2), 3);
+    EXPECT_EQ(table.count_in_column(3), 1);
+    EXPECT_TRUE(counts.is_row_full(1));
+    EXPECT_TRUE(counts.is_column_full(2));
+    EXPECT_FALSE(counts.is_column_full(0));
+    EXPECT_EQ(counts.number_of_full_rows(), 1);
+    EXPECT_EQ(counts.number_of_full_columns(), 1);
+
+    table.erase(1, 2);
+    EXPECT_EQ(counts.number_of_full_rows(), 0);
+    EXPECT_EQ(counts.number_of_full_columns(), 0);
+    EXPECT_EQ(table.count_in_column(2), 2);
+
+    ds::table<int> plain(3, 4);
+    plain.emplace(0, 2, 1);
+    plain.emplace(2, 2, 1);
+    EXPECT_EQ(plain.count_in_row(0), 1);
+    EXPECT_EQ(plain.count_in_row(1), 0);
+    EXPECT_EQ(plain.count_in_column(2), 2);
+
+    table.reset();
+    EXPECT_EQ(table.count_in_row(1), 0);
+    EXPECT_EQ(table.policy<ds::occupancy_counts>().number_of_full_rows(), 0);
+}
+
+TEST(Table, CombinedPolicies) {
+    ds::table<int, ds::row_index, ds::occupancy_counts> table(4, 4);
+    table.emplace(3, 3, 1);
+    table.emplace(3, 0, 2);
+
+    EXPECT_EQ(table.count_in_row(3), 2);
+
+    std::vector<int> columns;
+    table.for_each_in_row(3, [&](int column, int) { columns.push_back(column); });
+    EXPECT_EQ(columns, (std::vector {0, 3}));
+}
+
+TEST(Table, RealTimeOperations) {
+    ds::table<int, ds::occupancy_counts> table(4, 4);
+    table.reserve(3);
+    ASSERT_GE(table.capacity(), 3);
+
+    auto const capacity = table.capacity();
+    auto const data = table.data();
+
+    static_assert(noexcept(table.try_set(0, 0, 0)) && noexcept(table.try_erase(0, 0)));
+    static_assert(!noexcept(std::declval<ds::table<int, ds::reverse_index<int>>&>().try_set(0, 0, 0)));
+
+    for (auto i = 0; i < static_cast<int>(capacity); ++i) {
+        EXPECT_EQ(table.try_set(i / 4, i % 4, i), ds::status::ok);
+    }
+
+    EXPECT_EQ(table.try_set(3, 3, 9), ds::status::full);
+    EXPECT_EQ(table.try_set(0, 0, 9), ds::status::ok);
+    EXPECT_EQ(table.at(0, 0), 9);
+    EXPECT_EQ(table.try_set(4, 0, 9), ds::status::out_of_range);
+    EXPECT_EQ(table.try_emplace(-1, 0, 9), ds::status::out_of_range);
+    EXPECT_EQ(table.data(), data);
+
+    EXPECT_EQ(table.try_get(9, 9), nullptr);
+    EXPECT_EQ(table.try_get(0, 0), table.get(0, 0));
+
+    EXPECT_EQ(table.try_erase(0, 0), ds::status::ok);
+    EXPECT_EQ(table.try_erase(0, 0), ds::status::empty);
+    EXPECT_EQ(table.try_erase(0, 9), ds::status::out_of_range);
+    EXPECT_EQ(table.count(), capacity - 1);
+    EXPECT_EQ(table.count_in_row(0), static_cast<int>(std::min<std::size_t>(capacity, 4)) - 1);
+
+    for (auto i = 1; i < static_cast<int>(capacity); ++i) {
+        EXPECT_EQ(table.at(i / 4, i % 4), i);
+    }
+
+    EXPECT_EQ(table.try_emplace(3, 3, 7), ds::status::ok);
+    table.reset();
+    EXPECT_TRUE(table.empty());
+    EXPECT_EQ(table.capacity(), capacity);
+    EXPECT_EQ(table.count_in_row(0), 0);
+    EXPECT_FALSE(table.contains(3, 3));
+    EXPECT_EQ(table.data(), data);
+}
+
+TEST(Table, Scroll) {
+    int const rows = 9;
+    int const cols = 70;
+
+    ds::table<int, ds::row_index, ds::column_index, ds::occupancy_counts> table(rows, cols);
+    std::vector<std::vector<int>> model(rows, std::vector<int>(cols, 0));
+
+    std::mt19937 mersenne(5);
+    std::uniform_int_distribution<int> row(0, rows - 1);
+    std::uniform_int_distribution<int> col(0, cols - 1);
+    std::uniform_int_distribution<int> shift(-3, 3);
+
+    auto const expect_model = [&] {
+        auto count = std::size_t {0};
+        for (auto r = 0; r < rows; ++r) {
+            std::vector<std::pair<int, int>> expected;
+            std::vector<std::pair<int, int>> actual;
+
+            for (auto c = 0; c < cols; ++c) {
+                auto const value = table.get(r, c);
+                ASSERT_EQ(value != nullptr, model[r][c] != 0);
+                if (value) {
+                    EXPECT_EQ(*value, model[r][c]);
+                    expected.emplace_back(c, model[r][c]);
+                }
+            }
+
+            table.for_each_in_row(r, [&](int c, int value) { actual.emplace_back(c, value); });
+            EXPECT_EQ(actual, expected);
+            EXPECT_EQ(table.count_in_row(r), static_cast<int>(expected.size()));
+            count += expected.size();
+        }
+
+        for (auto c = 0; c < cols; ++c) {
+            std::vector<int> expected;
+            std::vector<int> actual;
+
+            for (auto r = 0; r < rows; ++r) {
+                if (model[r][c] != 0)
+                    expected.push_back(r);
+            }
+
+            table.for_each_in_column(c, [&](int r, int) { actual.push_back(r); });
+            EXPECT_EQ(actual, expected);
+            EXPECT_EQ(table.count_in_column(c), static_cast<int>(expected.size()));
+        }
+
+        ASSERT_EQ(table.count(), count);
+        for (auto const& [r, c, value]: table.occupied()) {
+            EXPECT_EQ(model[r][c], value);
+        }
+    };
+
+    for (auto step = 0; step < 300; ++step) {
+        for (auto _ = 0; _ < 20; ++_) {
+            auto const r = row(mersenne);
+            auto const c = col(mersenne);
+
+            if (model[r][c] != 0 && c % 2 == 0) {
+                table.erase(r, c);
+                model[r][c] = 0;
+            } else {
+                table.set(r, c, step * 100 + c + 1);
+                model[r][c] = step * 100 + c + 1;
+            }
+        }
+
+        auto const dr = shift(mersenne);
+        auto const dc = shift(mersenne);
+        table.scroll(dr, dc);
+
+        std::vector<std::vector<int>> scrolled(rows, std::vector<int>(cols, 0));
+        for (auto r = 0; r < rows; ++r) {
+            for (auto c = 0; c < cols; ++c) {
+                if (r + dr >= 0 && r + dr < rows && c + dc >= 0 && c + dc < cols)
+                    scrolled[r][c] = model[r + dr][c + dc];
+            }
+        }
+
+        model = scrolled;
+        expect_model();
+    }
+
+    EXPECT_NE(table.origin(), std::make_pair(0, 0));
+    table.normalise();
+    EXPECT_EQ(table.origin(), std::make_pair(0, 0));
+    expect_model();
+
+    for (auto i = std::size_t {0}; i < table.count(); ++i) {
+        auto const t = table.indices()[i];
+        EXPECT_EQ(table.data()[i], model[t / cols][t % cols]);
+    }
+
+    table.set(2, 5, -1);
+    table.scroll(2, -5);
+    table.set_size(rows, cols - 1);
+    EXPECT_EQ(table.origin(), std::make_pair(0, 0));
+    EXPECT_EQ(table.at(0, 10), -1);
+
+    table.scroll(1, 0);
+    EXPECT_NE(table.origin(), std::make_pair(0, 0));
+    EXPECT_THROW(table.set(-1, 2, 5), std::out_of_range);
+    EXPECT_THROW(table.set(rows, 2, 5), std::out_of_range);
+    EXPECT_EQ(table.try_set(-1, 2, 5), ds::status::out_of_range);
+
+    table.scroll(rows, 0);
+    EXPECT_TRUE(table.empty());
+}
+
+TEST(Table, Blit) {
+    ds::table<int> source(6, 8);
+    for (auto row = 0; row < 6; ++row) {
+        for (auto col = 0; col < 8; ++col) {
+            if ((row + col) % 5 != 0)
+                source.emplace(row, col, row * 10 + col);
+        }
+    }
+
+    ds::table<int, ds::row_index, ds::occupancy_counts> target(5, 5);
+    target.set(0, 0, -1);
+    target.set(2, 3, -2);
+    target.set(4, 4, -3);
+
+    target.blit(source, {1, 2, 4, 5}, 1, 1);
+
+    for (auto row = 0; row < 5; ++row) {
+        for (auto col = 0; col < 5; ++col) {
+            auto const y = row + 0;
+            auto const x = col + 1;
+            auto const copied = row >= 1 && col >= 1 && source.get(y, x) != nullptr;
+            auto const value = target.get(row, col);
+
+            if (copied) {
+                ASSERT_NE(value, nullptr);
+                EXPECT_EQ(*value, y * 10 + x);
+            } else if (row == 0 && col == 0) {
+                EXPECT_EQ(*value, -1);
+            } else if (row == 4 && col == 4) {
+                EXPECT_EQ(*value, -3);
+            } else if (row == 2 && col == 3) {
+                EXPECT_EQ(*value, -2);
+            } else {
+                EXPECT_EQ(value, nullptr);
+            }
+        }
+
+        std::vector<int> columns;
+        target.for_each_in_row(row, [&](int col, int) { columns.push_back(col); });
+        EXPECT_EQ(target.count_in_row(row), static_cast<int>(columns.size()));
+    }
+
+    ds::table<int> same(4, 4);
+    for (auto k = 0; k < 4; ++k) {
+        same.set(0, k, k + 1);
+    }
+
+    same.blit(same, {0, 0, 1, 4}, 0, 1);
+    EXPECT_EQ(same.at(0, 0), 1);
+    EXPECT_EQ(same.at(0, 1), 1);
+    EXPECT_EQ(same.at(0, 3), 3);
+
+    ds::table<int> sparse(100, 100);
+    sparse.set(50, 50, 7);
+    same.blit(sparse, {0, 0, 100, 100}, -48, -48);
+    EXPECT_EQ(same.at(2, 2), 7);
+    EXPECT_EQ(same.count(), 5);
+}
+
+TEST(Table, FillAndClear) {
+    ds::table<int, ds::occupancy_counts> table(6, 6);
+    table.set(0, 0, 1);
+    table.set(2, 2, 1);
+
+    table.fill({1, 1, 3, 10}, 9);
+    EXPECT_EQ(table.count(), 1 + 3 * 5);
+    EXPECT_EQ(table.at(0, 0), 1);
+    EXPECT_EQ(table.at(2, 2), 9);
+    EXPECT_EQ(table.at(3, 5), 9);
+    EXPECT_FALSE(table.contains(4, 1));
+    EXPECT_EQ(table.count_in_row(2), 5);
+
+    table.clear({2, 0, 1, 6});
+    EXPECT_EQ(table.count(), 1 + 2 * 5);
+    EXPECT_EQ(table.count_in_row(2), 0);
+
+    table.clear({-10, -10, 100, 100});
+    EXPECT_TRUE(table.empty());
+    EXPECT_EQ(table.policy<ds::occupancy_counts>().count_in_column(1), 0);
+
+    table.fill({0, 0, 6, 6}, 2);
+    table.scroll(1, 1);
+    table.clear({0, 0, 2, 2});
+    EXPECT_EQ(table.count(), 25 - 4);
+    EXPECT_FALSE(table.contains(1, 1));
+    EXPECT_TRUE(table.contains(2, 2));
+
+    ds::table<int> cells(32, 32);
+    auto reallocations = 0;
+    for (auto k = 0; k < 32 * 32; ++k) {
+        auto const capacity = cells.capacity();
+        cells.fill({k / 32, k % 32, 1, 1}, k);
+        reallocations += cells.capacity() != capacity;
+    }
+
+    EXPECT_EQ(cells.count(), 32 * 32);
+    EXPECT_LE(reallocations, 12);
+}
+
+TEST(Table, ReverseIndex) {
+    struct entity {
+        int id;
+        float health;
+    };
+
+    struct entity_id {
+        int operator()(entity const& e) const { return e.id; }
+    };
+
+    using by_id = ds::reverse_index<int, entity_id>;
+    ds::table<entity, by_id> table(8, 8);
+    table.set(1, 2, {4711, 1.0f});
+    table.emplace(3, 4, entity {42, 0.5f});
+    table.set(5, 6, {7, 0.25f});
+
+    EXPECT_EQ(table.position_of<by_id>(4711), std::make_pair(1, 2));
+    EXPECT_EQ(table.position_of<by_id>(42), std::make_pair(3, 4));
+    EXPECT_FALSE(table.position_of<by_id>(0).has_value());
+
+    table.erase(1, 2);
+    EXPECT_FALSE(table.position_of<by_id>(4711).has_value());
+    EXPECT_EQ(table.position_of<by_id>(7), std::make_pair(5, 6));
+
+    table.set(3, 4, {43, 0.5f});
+    EXPECT_FALSE(table.position_of<by_id>(42).has_value());
+    EXPECT_EQ(table.position_of<by_id>(43), std::make_pair(3, 4));
+
+    EXPECT_EQ(table.try_set(0, 0, {1, 0.0f}), ds::status::ok);
+    EXPECT_EQ(table.try_erase(5, 6), ds::status::ok);
+    EXPECT_EQ(table.position_of<by_id>(1), std::make_pair(0, 0));
+    EXPECT_FALSE(table.position_of<by_id>(7).has_value());
+
+    table.scroll(-2, 1);
+    EXPECT_EQ(table.position_of<by_id>(43), std::make_pair(5, 3));
+    EXPECT_FALSE(table.position_of<by_id>(1).has_value());
+
+    table.normalise();
+    EXPECT_EQ(table.position_of<by_id>(43), std::make_pair(5, 3));
+    EXPECT_EQ(table.policy<by_id>().size(), table.count());
+
+    ds::table<int, ds::reverse_index<int>> ids(4, 4);
+    for (auto k = 0; k < 16; ++k) {
+        ids.set(k / 4, k % 4, 100 + k);
+    }
+
+    for (auto k = 0; k < 16; k += 3) {
+        ids.erase(k / 4, k % 4);
+    }
+
+    for (auto k = 0; k < 16; ++k) {
+        auto const position = ids.position_of<ds::reverse_index<int>>(100 + k);
+        EXPECT_EQ(position.has_value(), k % 3 != 0);
+        if (position) {
+            EXPECT_EQ(*position, std::make_pair(k / 4, k % 4));
+        }
+    }
+}
+
+TEST(Table, GetMany) {
+    ds::table<int> table(37, 41);
+    std::mt19937 mersenne(4);
+    std::uniform_int_distribution<int> row(-2, 38);
+    std::uniform_int_distribution<int> col(-2, 42);
+
+    for (auto _ = 0; _ < 600; ++_) {
+        auto const r = row(mersenne);
+        auto const c = col(mersenne);
+        table.try_set(r, c, r * 100 + c);
+    }
+
+    table.scroll(3, -2);
+
+    std::vector<std::pair<int, int>> positions(1000);
+    for (auto& [r, c]: positions) {
+        r = row(mersenne);
+        c = col(mersenne);
+    }
+
+    std::vector<int const*> results(positions.size());
+    table.get_many(positions.data(), positions.size(), results.data());
+
+    for (auto k = std::size_t {0}; k < positions.size(); ++k) {
+        EXPECT_EQ(results[k], table.try_get(positions[k].first, positions[k].second));
+    }
+
+    std::vector<int*> mutable_results(3);
+    table.get_many(positions.data(), 3, mutable_results.data());
+    EXPECT_EQ(mutable_results[2], table.try_get(positions[2].first, positions[2].second));
+}
+
 int main(int argc, char* argv[]) {
     ::testing::InitGoogleTest(&argc, argv);
 
@@ -0,0 +1,56 @@
+//! @file views.cpp
+//! @date 17/10/26
+//! @brief Tests for the C++20 ranges integration of the row, column and occupancy views.
+//! @author David Spry
+
+#include <vector>
+#include <ranges>
+#include <numeric>
+#include <gtest/gtest.h>
+
+#include "../include/table.hpp"
+
+using table_type = ds::table<int>;
+
+static_assert(std::ranges::random_access_range<decltype(std::declval<table_type const&>().row(0))>);
+static_assert(std::ranges::sized_range<decltype(std::declval<table_type const&>().row(0))>);
+static_assert(std::ranges::borrowed_range<decltype(std::declval<table_type const&>().row(0))>);
+static_assert(std::ranges::view<decltype(std::declval<table_type const&>().col(0))>);
+static_assert(std::ranges::random_access_range<decltype(std::declval<table_type const&>().rows())>);
+static_assert(std::ranges::random_access_range<decltype(std::declval<table_type const&>().occupied())>);
+static_assert(std::ranges::contiguous_range<table_type const&>);
+
+TEST(Views, ComposeWithRangeAdaptors) {
+    table_type table(4, 6);
+
+    for (auto col = 0; col < 6; col += 2) {
+        table.emplace(1, col, col);
+    }
+
+    table.emplace(3, 4, 40);
+
+    auto values = table.row(1)
+                | std::views::filter([](int const* cell) { return cell != nullptr; })
+                | std::views::transform([](int const* cell) { return *cell * 10; });
+
+    std::vector<int> collected(values.begin(), values.end());
+    EXPECT_EQ(collected, (std::vector {0, 20, 40}));
+
+    auto occupied_rows = table.rows()
+                       | std::views::filter([](auto const& row) {
+                             return std::ranges::any_of(row, [](int const* cell) { return cell != nullptr; });
+                         });
+
+    EXPECT_EQ(std::ranges::distance(occupied_rows), 2);
+
+    auto column = table.col(4) | std::views::reverse;
+    EXPECT_EQ(**std::ranges::begin(column), 40);
+
+    auto sum = 0;
+    for (auto const& item: table.occupied() | std::views::filter([](auto const& cell) { return cell.row == 3; })) {
+        sum += item.value + item.column;
+    }
+
+    EXPECT_EQ(sum, 44);
+    EXPECT_EQ(std::accumulate(table.begin(), table.end(), 0), 46);
+}
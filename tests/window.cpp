@@ -0,0 +1,127 @@
+//! @file window.cpp
+//! @date 17/10/26
+//! @brief Tests for the sliding-window time-series table.
+//! @author David Spry
+
+#include <deque>
+#include <random>
+#include <vector>
+#include <numeric>
+#include <algorithm>
+#include <gtest/gtest.h>
+
+#include "../include/table/window.hpp"
+
+TEST(SlidingWindow, DenseRows) {
+    ds::sliding_window<int> window(3, 2);
+
+    int const rows[][2] = {{1, 10}, {5, 20}, {3, 30}, {2, 40}};
+    for (auto const& row: rows) {
+        window.push_row(row);
+    }
+
+    EXPECT_EQ(window.size(), 3);
+    EXPECT_EQ(window.sum(0), 10);
+    EXPECT_EQ(window.sum(1), 90);
+    EXPECT_EQ(*window.min(0), 2);
+    EXPECT_EQ(*window.max(0), 5);
+    EXPECT_EQ(*window.min(1), 20);
+    EXPECT_EQ(*window.max(1), 40);
+    EXPECT_DOUBLE_EQ(window.mean(1), 30.0);
+
+    EXPECT_EQ(window.contents().at(2, 0), 2);
+    EXPECT_EQ(window.contents().at(0, 1), 20);
+
+    std::vector<std::pair<int, int>> const outside {{0, 7}, {2, 7}};
+    EXPECT_THROW(window.push_row(outside.begin(), outside.end()), std::out_of_range);
+    EXPECT_EQ(window.size(), 3);
+    EXPECT_EQ(window.sum(0), 10);
+
+    std::vector<std::pair<int, int>> const repeated {{1, 50}, {0, 6}, {1, 60}};
+    EXPECT_THROW(window.push_row(repeated.begin(), repeated.end()), std::invalid_argument);
+    EXPECT_EQ(window.size(), 3);
+    EXPECT_EQ(window.sum(1), 90);
+
+    window.pop_row();
+    window.pop_row();
+    EXPECT_EQ(window.size(), 1);
+    EXPECT_EQ(*window.min(0), 2);
+    EXPECT_EQ(*window.max(1), 40);
+
+    window.pop_row();
+    window.pop_row();
+    EXPECT_EQ(window.size(), 0);
+    EXPECT_EQ(window.min(0), nullptr);
+    EXPECT_EQ(window.count(1), 0);
+    EXPECT_DOUBLE_EQ(window.mean(1), 0.0);
+}
+
+TEST(SlidingWindow, SparseRowsAgainstModel) {
+    std::size_t const rows = 7;
+    std::size_t const cols = 5;
+
+    ds::sliding_window<int> window(rows, cols);
+    std::deque<std::vector<std::pair<int, int>>> model;
+
+    std::mt19937 mersenne(3);
+    std::bernoulli_distribution occupied(0.6);
+    std::bernoulli_distribution pop(0.2);
+    std::uniform_int_distribution<int> value(-50, 50);
+
+    for (auto step = 0; step < 500; ++step) {
+        if (pop(mersenne)) {
+            window.pop_row();
+            if (!model.empty())
+                model.pop_front();
+        } else {
+            std::vector<std::pair<int, int>> row;
+            for (auto column = 0; column < static_cast<int>(cols); ++column) {
+                if (occupied(mersenne))
+                    row.emplace_back(column, value(mersenne));
+            }
+
+            window.push_row(row.begin(), row.end());
+            model.push_back(row);
+            if (model.size() > rows)
+                model.pop_front();
+        }
+
+        ASSERT_EQ(window.size(), model.size());
+
+        std::vector<double> means(cols);
+        window.means(means.data());
+
+        for (auto column = 0; column < static_cast<int>(cols); ++column) {
+            std::vector<int> values;
+            for (auto const& row: model) {
+                for (auto const& [c, v]: row) {
+                    if (c == column)
+                        values.push_back(v);
+                }
+            }
+
+            auto const sum = std::accumulate(values.begin(), values.end(), 0);
+            EXPECT_EQ(window.sum(column), sum);
+            EXPECT_EQ(window.sums()[column], sum);
+            EXPECT_EQ(window.count(column), static_cast<int>(values.size()));
+
+            if (values.empty()) {
+                EXPECT_EQ(window.min(column), nullptr);
+                EXPECT_EQ(window.max(column), nullptr);
+                EXPECT_DOUBLE_EQ(means[column], 0.0);
+            } else {
+                EXPECT_EQ(*window.min(column), *std::min_element(values.begin(), values.end()));
+                EXPECT_EQ(*window.max(column), *std::max_element(values.begin(), values.end()));
+                EXPECT_DOUBLE_EQ(means[column], static_cast<double>(sum) / values.size());
+                EXPECT_DOUBLE_EQ(window.mean(column), means[column]);
+            }
+        }
+
+        auto const first = static_cast<int>(rows - model.size());
+        for (auto k = 0; k < static_cast<int>(model.size()); ++k) {
+            for (auto const& [c, v]: model[k]) {
+                EXPECT_EQ(window.contents().at(first + k, c), v);
+            }
+        }
+    }
+}